@@ -0,0 +1,793 @@
+/* sprite sheets and images of Mike O'Possum */
+
+#include <stdio.h>          /* fopen(), snprintf() */
+#include <stdlib.h>         /* malloc(), free() */
+#include <string.h>         /* strcmp() */
+#include <time.h>           /* clock_gettime() */
+#include <unistd.h>         /* sysconf() */
+#include <fcntl.h>          /* open() */
+#include <sys/mman.h>       /* mmap() */
+#include <sys/stat.h>       /* fstat() */
+#include <pthread.h>
+#include <SDL/SDL.h>
+#include <SDL/SDL_image.h>
+
+#include "sprites.h"        /* images embedded as PNG */
+#include "pixels.h"         /* sprite sheets decoded at build time */
+#include "level.h"          /* crc32c(), rle_unpack() */
+#include "filewatch.h"      /* hot reload of the sheets */
+#include "registry.h"       /* memory accounting */
+#include "assets.h"
+
+
+enum assetstate {
+  ASSET_UNLOADED = 0,
+  ASSET_LOADING,            /* being decoded by some thread */
+  ASSET_LOADED
+};
+
+/* an asset embedded in the binary */
+struct embeddedasset {
+  char *name;
+  int framew;               /* the frames are side by side on the top row of the sheet, 0 for a single image */
+  int frameh;
+  int framecount;
+  unsigned int *pixels;     /* the whole sheet, as decoded by mkpixels, NULL if not available */
+  unsigned int *pixelsw;    /* width of the sheet */
+  unsigned int *pixelslen;  /* number of pixels of the sheet */
+  unsigned char *png;       /* the asset as PNG, if there are no pixels */
+  unsigned int *pnglen;
+  char *mirror;             /* the asset this one is a mirror of, if it is one, NULL otherwise */
+};
+
+/* the data of an asset, wherever it comes from, ready to be decoded */
+struct assetsource {
+  int framew;               /* 0 for a single image */
+  int frameh;
+  int framecount;
+  unsigned int *pixels;     /* decoded pixels, NULL if there are none */
+  unsigned long pixelsw;
+  unsigned long pixelsh;
+  unsigned char *png;       /* PNG data, if there are no pixels */
+  unsigned long pnglen;
+};
+
+/* an asset, where it can be found, and its decoded form when loaded */
+struct assetentry {
+  char name[ASSETPACK_NAMELEN + 1];
+  struct embeddedasset *embedded; /* NULL if the asset is only in the pack */
+  unsigned char *packed;    /* its data in the mapped pack, NULL if not in the pack */
+  int packframew;
+  int packframeh;
+  int packframecount;
+  unsigned int packflags;
+  unsigned long packsize;
+  unsigned long packrawsize;
+  unsigned long packcrc;
+  char packmirror[ASSETPACK_NAMELEN + 1]; /* the asset the pack says this one is a mirror of, empty if none */
+  enum assetstate state;
+  int refcount;
+  long bytes;               /* memory used by the decoded asset */
+  unsigned long lastuse;    /* when the asset has been used for the last time, for eviction */
+  unsigned char *unpacked;  /* data of the pack once RLE-unpacked, or the sheet of a mirror, if the decoded asset uses it */
+  struct asset asset;
+  SDL_Surface *reloaded[ASSETS_MAXFRAMES]; /* frames decoded again from disk, waiting for reloadassets() */
+  int reloadedcount;        /* 0 if there are none */
+  long reloadedbytes;
+};
+
+/* all the loading work of loadassets() */
+struct assetbatch {
+  struct assetjob *job;
+  int count;
+  int next;                 /* next job to be picked by a thread */
+  pthread_mutex_t lock;
+};
+
+static struct embeddedasset embedded[] = {
+  {"tiles", 16, 16, 64, tiles_pixels, &tiles_pixels_w, &tiles_pixels_len, NULL, NULL, NULL},
+  {"possum_left", 54, 75, 9, possum_left_pixels, &possum_left_pixels_w, &possum_left_pixels_len, NULL, NULL, NULL},
+  {"possum_right", 0, 0, 0, NULL, NULL, NULL, NULL, NULL, "possum_left"},
+  {"bg", 0, 0, 1, NULL, NULL, NULL, bg_png, &bg_png_len, NULL},
+  {NULL, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, NULL}
+};
+
+static struct assetentry assets[ASSETS_MAX];
+static int assetcount;
+static pthread_once_t assetsinit = PTHREAD_ONCE_INIT;
+
+/* protects the state, references and usage of all assets */
+static pthread_mutex_t assetlock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t assetloaded = PTHREAD_COND_INITIALIZER;
+static long assetbudget = ASSETS_BUDGET;
+static long assetbytes;     /* memory used by all decoded assets */
+static unsigned long assetclock;
+static char assetdir[ASSETS_MAXDIRLEN + 1]; /* where sheets are loaded from in development mode, empty otherwise */
+static struct filewatch *assetwatch;
+static int assetreloads;    /* assets with reloaded frames waiting */
+
+#define ASSETS_MAXFILELEN (ASSETS_MAXDIRLEN + ASSETPACK_NAMELEN + 6)
+
+
+static unsigned int get16(const unsigned char *p) {
+  return((p[0] << 8) | p[1]);
+}
+
+static unsigned long get32(const unsigned char *p) {
+  return(((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) | ((unsigned long)p[2] << 8) | p[3]);
+}
+
+
+/* lists the embedded assets, and sets up the PNG decoder, once. SDL_image
+ * sets it up lazily otherwise, on the first decode, which isn't safe when
+ * that first decode happens on several threads at once. */
+static void initassets(void) {
+  struct embeddedasset *e;
+  IMG_Init(IMG_INIT_PNG);
+  for (e = embedded; (e->name != NULL) && (assetcount < ASSETS_MAX); e++) {
+    strncpy(assets[assetcount].name, e->name, ASSETPACK_NAMELEN);
+    assets[assetcount].embedded = e;
+    assetcount++;
+  }
+}
+
+
+/* reads a whole file into a newly allocated buffer */
+static unsigned char *readfile(char *file, long *len) {
+  FILE *fd;
+  unsigned char *buff;
+  fd = fopen(file, "rb");
+  if (fd == NULL) return(NULL);
+  fseek(fd, 0, SEEK_END);
+  *len = ftell(fd);
+  fseek(fd, 0, SEEK_SET);
+  buff = malloc(*len + 1);
+  if ((buff != NULL) && (fread(buff, 1, *len, fd) != (size_t)*len)) {
+    free(buff);
+    buff = NULL;
+  }
+  fclose(fd);
+  return(buff);
+}
+
+
+static struct assetentry *findasset(char *name) {
+  int i;
+  for (i = 0; i < assetcount; i++) {
+    if (strcmp(assets[i].name, name) == 0) return(&(assets[i]));
+  }
+  return(NULL);
+}
+
+
+/* decodes a PNG, from any thread. SDL keeps a single error message for
+ * all threads, so a failure is only told by the NULL returned, never by
+ * SDL_GetError(). */
+static SDL_Surface *decodepng(unsigned char *png, unsigned long pnglen) {
+  SDL_Surface *result;
+  SDL_RWops *rwop;
+  rwop = SDL_RWFromMem(png, pnglen);
+  result = IMG_LoadPNG_RW(rwop);
+  SDL_FreeRW(rwop);
+  return(result);
+}
+
+
+/* decodes the PNG of a sheet and cuts it into frames */
+static int slicesheet(struct assetentry *entry, struct assetsource *src) {
+  SDL_Surface *spritesheet, **frame = entry->asset.frame;
+  SDL_Rect rect;
+  int i;
+  spritesheet = decodepng(src->png, src->pnglen);
+  if (spritesheet == NULL) return(-1);
+  for (i = 0; i < src->framecount; i++) {
+    rect.x = i * src->framew;
+    rect.y = 0;
+    rect.w = src->framew;
+    rect.h = src->frameh;
+    frame[i] = SDL_CreateRGBSurface(SDL_SWSURFACE | SDL_SRCALPHA, src->framew, src->frameh, 32, ASSET_RMASK, ASSET_GMASK, ASSET_BMASK, ASSET_AMASK);  /* I'm setting alpha to 0, because otherwise sdl for some strange reason uses the destination alpha mask :/ */
+    if (frame[i] == NULL) {
+      while (i-- > 0) registry_freesurface(frame[i]);
+      SDL_FreeSurface(spritesheet);
+      return(-1);
+    }
+    registry_addsurface(frame[i], entry->name, "assets");
+    SDL_FillRect(frame[i], NULL, 0x0);
+    SDL_BlitSurface(spritesheet, &rect, frame[i], NULL);
+    entry->bytes += frame[i]->h * frame[i]->pitch;
+  }
+  SDL_FreeSurface(spritesheet);
+  return(0);
+}
+
+
+/* wraps the frames of a decoded sheet into surfaces */
+static int wrapsheet(struct assetentry *entry, struct assetsource *src) {
+  SDL_Surface **frame = entry->asset.frame;
+  int i, framew = src->framew, frameh = src->frameh;
+  if (framew == 0) { /* a single image */
+    framew = src->pixelsw;
+    frameh = src->pixelsh;
+  }
+  /* the frames must fit in the sheet */
+  if (((unsigned long)(framew * src->framecount) > src->pixelsw) || ((unsigned long)frameh > src->pixelsh)) return(-1);
+  /* each frame is a window on the sheet: it starts framew pixels after the
+   * previous one, and its rows are as far apart as the rows of the sheet */
+  for (i = 0; i < src->framecount; i++) {
+    frame[i] = SDL_CreateRGBSurfaceFrom(src->pixels + i * framew, framew, frameh, 32, src->pixelsw * 4, ASSET_RMASK, ASSET_GMASK, ASSET_BMASK, ASSET_AMASK);
+    if (frame[i] == NULL) {
+      while (i-- > 0) registry_freesurface(frame[i]);
+      return(-1);
+    }
+    registry_addsurface(frame[i], entry->name, "assets");
+  }
+  return(0);
+}
+
+
+static int decodesource(struct assetentry *entry, struct assetsource *src) {
+  entry->asset.name = entry->name;
+  entry->asset.framecount = src->framecount;
+  if ((src->framecount < 1) || (src->framecount > ASSETS_MAXFRAMES)) return(-1);
+  if (src->pixels != NULL) return(wrapsheet(entry, src));
+  if (src->framew > 0) return(slicesheet(entry, src));
+  if (src->framecount != 1) return(-1);
+  entry->asset.frame[0] = registry_addsurface(decodepng(src->png, src->pnglen), entry->name, "assets");
+  if (entry->asset.frame[0] == NULL) return(-1);
+  entry->bytes += entry->asset.frame[0]->h * entry->asset.frame[0]->pitch;
+  return(0);
+}
+
+
+static void embeddedsource(struct embeddedasset *e, struct assetsource *src) {
+  src->framew = e->framew;
+  src->frameh = e->frameh;
+  src->framecount = e->framecount;
+  src->pixels = e->pixels;
+  src->pixelsw = 0;
+  src->pixelsh = 0;
+  if (e->pixels != NULL) {
+    src->pixelsw = *(e->pixelsw);
+    src->pixelsh = *(e->pixelslen) / *(e->pixelsw);
+  }
+  src->png = e->png;
+  src->pnglen = (e->png != NULL) ? *(e->pnglen) : 0;
+}
+
+
+/* checks the data of an asset in the pack and unpacks it if needed.
+ * returns 0 if it can be decoded. */
+static int packsource(struct assetentry *entry, struct assetsource *src) {
+  unsigned char *data = entry->packed;
+  unsigned long len = entry->packsize;
+  if (crc32c(0, data, len) != entry->packcrc) return(-1);
+  if (entry->packflags & ASSETPACK_RLE) {
+    entry->unpacked = registry_addbuffer(malloc(entry->packrawsize + 1), entry->packrawsize + 1, entry->name, "assets");
+    if (entry->unpacked == NULL) return(-1);
+    if (rle_unpack(entry->unpacked, entry->packrawsize, data, len) < 0) return(-1);
+    data = entry->unpacked;
+    len = entry->packrawsize;
+    entry->bytes += len;
+  }
+  src->framew = entry->packframew;
+  src->frameh = entry->packframeh;
+  src->framecount = entry->packframecount;
+  src->pixels = NULL;
+  src->png = data;
+  src->pnglen = len;
+  if ((len >= ASSETPIXELS_HEADERLEN) && (memcmp(data, ASSETPIXELS_MAGIC, 4) == 0)) {
+    src->pixelsw = get32(data + 4);
+    src->pixelsh = get32(data + 8);
+    if ((src->pixelsw == 0) || (src->pixelsh > (len - ASSETPIXELS_HEADERLEN) / 4 / src->pixelsw)) return(-1);
+    src->pixels = (unsigned int *)(data + ASSETPIXELS_HEADERLEN);
+  }
+  return(0);
+}
+
+
+static void freeunpacked(struct assetentry *entry) {
+  if (entry->unpacked != NULL) registry_freebuffer(entry->unpacked);
+  entry->unpacked = NULL;
+}
+
+
+/* returns the name of the asset an asset is a mirror of, or NULL if it
+ * isn't a mirror */
+static char *mirrorof(struct assetentry *entry) {
+  if (entry->packmirror[0] != 0) return(entry->packmirror);
+  if ((entry->packed == NULL) && (entry->embedded != NULL)) return(entry->embedded->mirror);
+  return(NULL);
+}
+
+
+/* builds an asset out of the frames of another one, each of them flipped
+ * left to right, side by side in a sheet of its own */
+static int mirrorasset(struct assetentry *entry, char *sourcename) {
+  struct assetentry *sourceentry;
+  struct asset *source;
+  struct assetsource src;
+  SDL_Surface *frame;
+  Uint32 *row, *dst;
+  int i, x, y, w, h, count, result = -1;
+  /* a mirror of a mirror could end up waiting for itself */
+  sourceentry = findasset(sourcename);
+  if ((sourceentry == NULL) || (sourceentry == entry) || (mirrorof(sourceentry) != NULL)) return(-1);
+  source = getasset(sourcename);
+  if (source == NULL) return(-1);
+  count = source->framecount;
+  w = source->frame[0]->w;
+  h = source->frame[0]->h;
+  for (i = 0; i < count; i++) {
+    frame = source->frame[i];
+    if ((frame->w != w) || (frame->h != h) || (frame->format->BitsPerPixel != 32)) goto DONE;
+  }
+  entry->unpacked = registry_addbuffer(malloc(w * h * count * 4), w * h * count * 4, entry->name, "assets");
+  if (entry->unpacked == NULL) goto DONE;
+  for (i = 0; i < count; i++) {
+    frame = source->frame[i];
+    SDL_LockSurface(frame);
+    for (y = 0; y < h; y++) {
+      row = (Uint32 *)((Uint8 *)frame->pixels + y * frame->pitch);
+      dst = (Uint32 *)entry->unpacked + (y * w * count) + (i * w);
+      for (x = 0; x < w; x++) dst[x] = row[w - 1 - x];
+    }
+    SDL_UnlockSurface(frame);
+  }
+  src.framew = w;
+  src.frameh = h;
+  src.framecount = count;
+  src.pixels = (unsigned int *)entry->unpacked;
+  src.pixelsw = w * count;
+  src.pixelsh = h;
+  src.png = NULL;
+  src.pnglen = 0;
+  result = decodesource(entry, &src);
+  if (result == 0) {
+      entry->bytes += w * h * count * 4;
+    } else {
+      freeunpacked(entry);
+  }
+
+  DONE:
+  releaseasset(source);
+  return(result);
+}
+
+
+/* the PNG file of an asset in development mode */
+static void assetfile(struct assetentry *entry, char *file) {
+  snprintf(file, ASSETS_MAXFILELEN, "%s/%.*s.png", assetdir, ASSETPACK_NAMELEN, entry->name);
+}
+
+
+/* decodes an asset from its PNG file in the assets directory, cut into
+ * frames as told by the pack or the binary */
+static int diskasset(struct assetentry *entry) {
+  struct assetsource src;
+  char file[ASSETS_MAXFILELEN];
+  unsigned char *png;
+  long len;
+  int result;
+  if (mirrorof(entry) != NULL) return(-1); /* built from its source instead */
+  if (entry->packed != NULL) {
+      src.framew = entry->packframew;
+      src.frameh = entry->packframeh;
+      src.framecount = entry->packframecount;
+    } else if (entry->embedded != NULL) {
+      src.framew = entry->embedded->framew;
+      src.frameh = entry->embedded->frameh;
+      src.framecount = entry->embedded->framecount;
+    } else {
+      return(-1);
+  }
+  assetfile(entry, file);
+  png = readfile(file, &len);
+  if (png == NULL) return(-1);
+  src.pixels = NULL;
+  src.pixelsw = 0;
+  src.pixelsh = 0;
+  src.png = png;
+  src.pnglen = len;
+  result = decodesource(entry, &src);
+  free(png); /* copied into the frames */
+  return(result);
+}
+
+
+/* decodes an asset, from the assets directory in development mode, from
+ * the pack if it's there, from the binary otherwise. called without the
+ * lock held. */
+static int decodeasset(struct assetentry *entry) {
+  struct assetsource src;
+  entry->bytes = 0;
+  if ((assetdir[0] != 0) && (diskasset(entry) == 0)) return(0);
+  entry->bytes = 0;
+  if (entry->packmirror[0] != 0) {
+      if (mirrorasset(entry, entry->packmirror) == 0) return(0);
+    } else if ((entry->packed != NULL) && (packsource(entry, &src) == 0) && (decodesource(entry, &src) == 0)) {
+      /* a PNG has been copied into surfaces, its unpacked data isn't needed anymore */
+      if ((src.pixels == NULL) && (entry->unpacked != NULL)) {
+        entry->bytes -= entry->packrawsize;
+        freeunpacked(entry);
+      }
+      return(0);
+  }
+  freeunpacked(entry);
+  entry->bytes = 0;
+  if (entry->embedded == NULL) return(-1);
+  if (entry->embedded->mirror != NULL) return(mirrorasset(entry, entry->embedded->mirror));
+  embeddedsource(entry->embedded, &src);
+  return(decodesource(entry, &src));
+}
+
+
+int openassetpack(char *file) {
+  struct assetentry *entry;
+  struct stat st;
+  unsigned char *map, *p;
+  char name[ASSETPACK_NAMELEN + 1];
+  unsigned long count, offset, size, i;
+  int fd;
+  pthread_once(&assetsinit, initassets);
+  fd = open(file, O_RDONLY);
+  if (fd < 0) return(-1);
+  if ((fstat(fd, &st) != 0) || (st.st_size < ASSETPACK_HEADERLEN)) {
+    close(fd);
+    return(-1);
+  }
+  /* private and writable, so surfaces can point into the pack with no risk
+   * of anything writing to the file */
+  map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) return(-1);
+  if ((memcmp(map, ASSETPACK_MAGIC, 4) != 0) || (get16(map + 4) != ASSETPACK_VERSION) || (get32(map + 12) != crc32c(0, map, 12))) goto FAIL;
+  count = get16(map + 6);
+  if (ASSETPACK_HEADERLEN + count * ASSETPACK_ENTRYLEN > (unsigned long)st.st_size) goto FAIL;
+  if (get32(map + 8) != crc32c(0, map + ASSETPACK_HEADERLEN, count * ASSETPACK_ENTRYLEN)) goto FAIL;
+  for (i = 0; i < count; i++) {
+    p = map + ASSETPACK_HEADERLEN + (i * ASSETPACK_ENTRYLEN);
+    offset = get32(p + 32);
+    size = get32(p + 36);
+    if ((offset % ASSETPACK_ALIGN != 0) || (offset > (unsigned long)st.st_size) || (size > (unsigned long)st.st_size - offset)) continue;
+    memcpy(name, p, ASSETPACK_NAMELEN);
+    name[ASSETPACK_NAMELEN] = 0;
+    entry = findasset(name);
+    if (entry == NULL) { /* a new asset, not embedded in the binary */
+      if (assetcount == ASSETS_MAX) continue;
+      entry = &(assets[assetcount++]);
+      strcpy(entry->name, name);
+      entry->embedded = NULL;
+    }
+    entry->packed = map + offset;
+    entry->packframew = get16(p + 24);
+    entry->packframeh = get16(p + 26);
+    entry->packframecount = get16(p + 28);
+    entry->packflags = get16(p + 30);
+    entry->packsize = size;
+    entry->packrawsize = get32(p + 40);
+    entry->packcrc = get32(p + 44);
+    entry->packmirror[0] = 0;
+    if ((entry->packflags & ASSETPACK_MIRROR) && (size <= ASSETPACK_NAMELEN) && (crc32c(0, entry->packed, size) == entry->packcrc)) {
+      memcpy(entry->packmirror, entry->packed, size);
+      entry->packmirror[size] = 0;
+    }
+  }
+  return(0);
+
+  FAIL:
+  munmap(map, st.st_size);
+  return(-1);
+}
+
+
+/* frees the frames of a decoded asset. called with the lock held. */
+static void unloadasset(struct assetentry *entry) {
+  int i;
+  for (i = 0; i < entry->asset.framecount; i++) registry_freesurface(entry->asset.frame[i]);
+  freeunpacked(entry);
+  assetbytes -= entry->bytes;
+  entry->bytes = 0;
+  entry->state = ASSET_UNLOADED;
+}
+
+
+/* frees the least recently used assets nobody uses, until decoded assets
+ * fit in the budget. called with the lock held. */
+static void evictassets(void) {
+  struct assetentry *entry, *oldest;
+  int i;
+  while (assetbytes > assetbudget) {
+    oldest = NULL;
+    for (i = 0; i < assetcount; i++) {
+      entry = &(assets[i]);
+      if ((entry->state != ASSET_LOADED) || (entry->refcount > 0) || (entry->bytes == 0)) continue;
+      if ((oldest == NULL) || (entry->lastuse < oldest->lastuse)) oldest = entry;
+    }
+    if (oldest == NULL) return; /* everything left is in use */
+    unloadasset(oldest);
+  }
+}
+
+
+struct asset *getasset(char *name) {
+  struct assetentry *entry;
+  pthread_once(&assetsinit, initassets);
+  entry = findasset(name);
+  if (entry == NULL) return(NULL);
+  pthread_mutex_lock(&assetlock);
+  while (entry->state == ASSET_LOADING) pthread_cond_wait(&assetloaded, &assetlock);
+  if (entry->state == ASSET_UNLOADED) {
+    /* first use: decode it, letting other assets be used meanwhile */
+    entry->state = ASSET_LOADING;
+    pthread_mutex_unlock(&assetlock);
+    if (decodeasset(entry) != 0) {
+      pthread_mutex_lock(&assetlock);
+      entry->state = ASSET_UNLOADED;
+      pthread_cond_broadcast(&assetloaded);
+      pthread_mutex_unlock(&assetlock);
+      return(NULL);
+    }
+    pthread_mutex_lock(&assetlock);
+    entry->state = ASSET_LOADED;
+    assetbytes += entry->bytes;
+    pthread_cond_broadcast(&assetloaded);
+  }
+  entry->refcount++;
+  entry->lastuse = ++assetclock;
+  evictassets();
+  pthread_mutex_unlock(&assetlock);
+  return(&(entry->asset));
+}
+
+
+void releaseasset(struct asset *asset) {
+  int i;
+  if (asset == NULL) return;
+  pthread_mutex_lock(&assetlock);
+  for (i = 0; i < assetcount; i++) {
+    if (&(assets[i].asset) != asset) continue;
+    assets[i].refcount--;
+    assets[i].lastuse = ++assetclock;
+    evictassets();
+    break;
+  }
+  pthread_mutex_unlock(&assetlock);
+}
+
+
+void setassetbudget(long bytes) {
+  pthread_mutex_lock(&assetlock);
+  assetbudget = bytes;
+  evictassets();
+  pthread_mutex_unlock(&assetlock);
+}
+
+
+void freeassets(void) {
+  int i;
+  pthread_mutex_lock(&assetlock);
+  for (i = 0; i < assetcount; i++) {
+    if ((assets[i].state == ASSET_LOADED) && (assets[i].refcount == 0)) unloadasset(&(assets[i]));
+  }
+  pthread_mutex_unlock(&assetlock);
+}
+
+
+void setassetjob(struct assetjob *job, char *name, SDL_Surface **frame, int maxframes) {
+  job->name = name;
+  job->frame = frame;
+  job->maxframes = maxframes;
+  job->asset = NULL;
+  job->result = -1;
+  job->usecs = 0;
+}
+
+
+static void loadjob(struct assetjob *job) {
+  struct timespec start, end;
+  int i;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  job->asset = getasset(job->name);
+  if ((job->asset != NULL) && (job->asset->framecount > job->maxframes)) { /* doesn't fit in frame[] */
+    releaseasset(job->asset);
+    job->asset = NULL;
+  }
+  if (job->asset != NULL) {
+    for (i = 0; i < job->asset->framecount; i++) job->frame[i] = job->asset->frame[i];
+    job->result = job->asset->framecount;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  job->usecs = ((end.tv_sec - start.tv_sec) * 1000000L) + ((end.tv_nsec - start.tv_nsec) / 1000L);
+}
+
+
+static void *assetworker(void *arg) {
+  struct assetbatch *batch = arg;
+  int i;
+  for (;;) {
+    pthread_mutex_lock(&batch->lock);
+    i = batch->next++;
+    pthread_mutex_unlock(&batch->lock);
+    if (i >= batch->count) break;
+    loadjob(&(batch->job[i]));
+  }
+  return(NULL);
+}
+
+
+int loadassets(struct assetjob *job, int count, int threads) {
+  struct assetbatch batch;
+  pthread_t thread[ASSETS_MAXTHREADS];
+  int started, i;
+  pthread_once(&assetsinit, initassets); /* here, before the workers start */
+  if (threads <= 0) threads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads > ASSETS_MAXTHREADS) threads = ASSETS_MAXTHREADS;
+  if (threads > count) threads = count;
+  batch.job = job;
+  batch.count = count;
+  batch.next = 0;
+  pthread_mutex_init(&batch.lock, NULL);
+  for (started = 0; started < threads; started++) {
+    if (pthread_create(&thread[started], NULL, assetworker, &batch) != 0) break;
+  }
+  if (started == 0) assetworker(&batch); /* no thread at all, do it ourselves */
+  for (i = 0; i < started; i++) pthread_join(thread[i], NULL);
+  pthread_mutex_destroy(&batch.lock);
+  for (i = 0; i < count; i++) {
+    if (job[i].result < 0) return(-1);
+  }
+  return(0);
+}
+
+
+/* called from the watcher thread whenever the file of an asset is
+ * rewritten: decodes it again, for reloadassets() to swap it in */
+static void assetfilechanged(char *file, void *userdata) {
+  struct assetentry *entry = userdata, fresh;
+  int i;
+  (void)file;
+  /* decoded apart, with only what never changes once the pack is open */
+  memset(&fresh, 0, sizeof(fresh));
+  strcpy(fresh.name, entry->name);
+  fresh.embedded = entry->embedded;
+  fresh.packed = entry->packed;
+  fresh.packframew = entry->packframew;
+  fresh.packframeh = entry->packframeh;
+  fresh.packframecount = entry->packframecount;
+  if (diskasset(&fresh) != 0) return; /* probably not fully written yet, another event will follow */
+  pthread_mutex_lock(&assetlock);
+  if (entry->reloadedcount == 0) {
+      assetreloads++;
+    } else { /* an older reload, never swapped in */
+      for (i = 0; i < entry->reloadedcount; i++) registry_freesurface(entry->reloaded[i]);
+  }
+  memcpy(entry->reloaded, fresh.asset.frame, sizeof(entry->reloaded));
+  entry->reloadedcount = fresh.asset.framecount;
+  entry->reloadedbytes = fresh.bytes;
+  pthread_mutex_unlock(&assetlock);
+}
+
+
+int watchassets(char *dir) {
+  struct assetentry *entry;
+  char file[ASSETS_MAXFILELEN];
+  int i;
+  if ((assetwatch != NULL) || (strlen(dir) > ASSETS_MAXDIRLEN)) return(-1);
+  pthread_once(&assetsinit, initassets);
+  assetwatch = filewatch_start();
+  if (assetwatch == NULL) return(-1);
+  strcpy(assetdir, dir);
+  for (i = 0; i < assetcount; i++) {
+    entry = &(assets[i]);
+    if (mirrorof(entry) != NULL) continue;
+    assetfile(entry, file);
+    filewatch_add(assetwatch, file, assetfilechanged, entry);
+  }
+  return(0);
+}
+
+
+void unwatchassets(void) {
+  int i, j;
+  if (assetwatch == NULL) return;
+  filewatch_stop(assetwatch);
+  assetwatch = NULL;
+  pthread_mutex_lock(&assetlock);
+  for (i = 0; i < assetcount; i++) {
+    for (j = 0; j < assets[i].reloadedcount; j++) registry_freesurface(assets[i].reloaded[j]);
+    assets[i].reloadedcount = 0;
+  }
+  assetreloads = 0;
+  pthread_mutex_unlock(&assetlock);
+}
+
+
+int assetreloadpending(void) {
+  int result;
+  pthread_mutex_lock(&assetlock);
+  result = assetreloads;
+  pthread_mutex_unlock(&assetlock);
+  return(result);
+}
+
+
+int reloadassets(struct assetjob *job, int count) {
+  struct assetentry *changed[ASSETS_MAX], *entry;
+  struct asset old;
+  unsigned char *oldunpacked;
+  char *source;
+  long oldbytes;
+  int i, j, n = 0, swapped;
+  pthread_mutex_lock(&assetlock);
+  for (i = 0; i < assetcount; i++) {
+    entry = &(assets[i]);
+    if (entry->reloadedcount == 0) continue;
+    if (entry->state == ASSET_LOADED) {
+        for (j = 0; j < entry->asset.framecount; j++) registry_freesurface(entry->asset.frame[j]);
+        freeunpacked(entry);
+        assetbytes += entry->reloadedbytes - entry->bytes;
+        memcpy(entry->asset.frame, entry->reloaded, sizeof(entry->reloaded));
+        entry->asset.framecount = entry->reloadedcount;
+        entry->bytes = entry->reloadedbytes;
+        changed[n++] = entry;
+      } else { /* not loaded: it will be read from disk when it is */
+        for (j = 0; j < entry->reloadedcount; j++) registry_freesurface(entry->reloaded[j]);
+    }
+    entry->reloadedcount = 0;
+  }
+  assetreloads = 0;
+  /* the mirrors of what changed must be built again: right away if they
+   * are in use, when they are used next otherwise */
+  swapped = n;
+  for (i = 0; i < assetcount; i++) {
+    entry = &(assets[i]);
+    source = mirrorof(entry);
+    if ((source == NULL) || (entry->state != ASSET_LOADED)) continue;
+    for (j = 0; j < swapped; j++) {
+      if (strcmp(changed[j]->name, source) == 0) break;
+    }
+    if (j == swapped) continue;
+    if (entry->refcount == 0) {
+        unloadasset(entry);
+      } else {
+        entry->state = ASSET_LOADING; /* nobody touches it while it's rebuilt */
+        changed[n++] = entry;
+    }
+  }
+  pthread_mutex_unlock(&assetlock);
+  /* the old frames of a mirror in use are only freed once the new ones are
+   * built: if that fails, the old ones stay */
+  for (i = swapped; i < n; i++) {
+    entry = changed[i];
+    old = entry->asset;
+    oldunpacked = entry->unpacked;
+    oldbytes = entry->bytes;
+    entry->unpacked = NULL;
+    entry->bytes = 0;
+    if (mirrorasset(entry, mirrorof(entry)) == 0) {
+        for (j = 0; j < old.framecount; j++) registry_freesurface(old.frame[j]);
+        if (oldunpacked != NULL) registry_freebuffer(oldunpacked);
+      } else {
+        entry->asset = old;
+        entry->unpacked = oldunpacked;
+        entry->bytes = oldbytes;
+    }
+    pthread_mutex_lock(&assetlock);
+    entry->state = ASSET_LOADED;
+    assetbytes += entry->bytes - oldbytes;
+    pthread_cond_broadcast(&assetloaded);
+    pthread_mutex_unlock(&assetlock);
+  }
+
+  /* hand the new frames over to the jobs that loaded these assets */
+  for (i = 0; i < count; i++) {
+    for (j = 0; j < n; j++) {
+      if (job[i].asset == &(changed[j]->asset)) break;
+    }
+    if (j == n) continue;
+    job[i].result = job[i].asset->framecount;
+    if (job[i].result > job[i].maxframes) job[i].result = job[i].maxframes;
+    for (j = 0; j < job[i].result; j++) job[i].frame[j] = job[i].asset->frame[j];
+  }
+  return(n);
+}
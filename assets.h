@@ -0,0 +1,164 @@
+/* sprite sheets and images of Mike O'Possum
+ *
+ * All graphics are embedded in the binaries. Sprite sheets are decoded at
+ * build time by mkpixels, which writes them to pixels.h as plain arrays of
+ * pixels, already in the format the game blits from: loading a sheet only
+ * wraps each of its frames into a surface pointing to these pixels, with
+ * no decoding and no copy. Other images (the background), and sheets
+ * that haven't been through mkpixels, stay embedded as PNG and are decoded
+ * when loaded.
+ *
+ * A sheet that is only another one flipped left to right, like the possum
+ * walking right, isn't embedded at all: it is declared as a mirror of the
+ * other one, and built from its frames when loaded.
+ *
+ * Assets are only loaded on first use, by getasset(), and shared: getting
+ * an asset again only takes a reference to it. Once released by all its
+ * users, a decoded asset stays around in case it is needed again, until
+ * the memory used by decoded assets exceeds the budget: the least recently
+ * used ones are then freed.
+ *
+ * In development mode, assets are loaded from their PNG file on disk
+ * (name.png), cut into frames just like the embedded ones, and decoded
+ * again in the background as soon as the file is rewritten. The new
+ * frames are swapped in by reloadassets(), between two frames of the game.
+ *
+ * loadassets() loads a whole set of assets at once, spread over several
+ * threads, and tells how long each of them took. The PNG decoder is set
+ * up on the calling thread beforehand. SDL keeps a single error message
+ * for all threads: a failed load is only told by what it returns, and
+ * SDL_GetError() says nothing reliable about it.
+ *
+ * Assets may also come from an asset pack, a file that is mmap()ed rather
+ * than read: the assets it holds replace the embedded ones, and the
+ * embedded ones are used for anything the pack doesn't hold (or holds
+ * damaged). Art can then be updated without rebuilding the binaries.
+ *
+ * asset pack format, all multi-bytes values being stored big endian
+ * (pixels excepted):
+ *
+ * header (16 bytes):
+ *   0  magic "APAK"
+ *   4  version (16 bits)
+ *   6  entries count (16 bits)
+ *   8  CRC32C of the table of contents (32 bits)
+ *  12  CRC32C of the 12 header bytes above (32 bits)
+ *
+ * table of contents, right after the header, one entry (48 bytes) per asset:
+ *   0  name (24 bytes, zero padded)
+ *  24  frame width, frame height, frames count (16 bits each), all frames
+ *      being side by side on the top row of the sheet. 0, 0, 1 for a
+ *      single image.
+ *  30  flags (16 bits): ASSETPACK_RLE if the data is RLE-packed,
+ *      ASSETPACK_MIRROR if the asset is a mirror of another one, whose
+ *      name (not zero terminated) is then the whole data
+ *  32  offset of the data (32 bits), a multiple of ASSETPACK_ALIGN
+ *  36  size of the data as stored (32 bits)
+ *  40  size of the data once unpacked (32 bits)
+ *  44  CRC32C of the data as stored (32 bits)
+ *
+ * the data of an asset is a PNG file, or pixels decoded by mkpixels -b:
+ *   0  magic "APIX"
+ *   4  width, height (32 bits each)
+ *  12  reserved (32 bits, 0)
+ *  16  the pixels, row after row, 32 bits each in the ASSET_*MASK format,
+ *      in the byte order of the machine that decoded them. unpacked, they
+ *      are used in place, straight from the mapped file. */
+
+#ifndef ASSETS_H_SENTINEL
+#define ASSETS_H_SENTINEL
+
+#include <SDL/SDL.h>
+
+/* pixel format of the sprite sheets: 32 bits RGBA */
+#define ASSET_RMASK 0xFF000000L
+#define ASSET_GMASK 0x00FF0000L
+#define ASSET_BMASK 0x0000FF00L
+#define ASSET_AMASK 0x000000FFL
+
+#define ASSETS_MAXFRAMES 64
+#define ASSETS_MAXTHREADS 8
+#define ASSETS_BUDGET (4 * 1024 * 1024L) /* default memory budget of decoded assets, in bytes */
+#define ASSETS_MAX 32       /* embedded assets and assets found in the pack */
+#define ASSETS_PACK "assets.pak" /* the pack the game and the editor use, if there is one */
+#define ASSETS_MAXDIRLEN 200  /* length of the directory assets are loaded from in development mode */
+
+#define ASSETPACK_MAGIC "APAK"
+#define ASSETPACK_VERSION 1
+#define ASSETPACK_HEADERLEN 16
+#define ASSETPACK_ENTRYLEN 48
+#define ASSETPACK_NAMELEN 24
+#define ASSETPACK_ALIGN 16
+#define ASSETPACK_RLE 1
+#define ASSETPACK_MIRROR 2
+
+#define ASSETPIXELS_MAGIC "APIX"
+#define ASSETPIXELS_HEADERLEN 16
+
+struct asset {
+  char *name;
+  int framecount;
+  SDL_Surface *frame[ASSETS_MAXFRAMES]; /* the frames of a sheet, or the image in frame[0] */
+};
+
+/* an asset to be loaded by loadassets(), and how it went */
+struct assetjob {
+  char *name;
+  SDL_Surface **frame;      /* where the frames of a sheet go, or the image in frame[0] */
+  int maxframes;
+  struct asset *asset;      /* the reference taken on the asset, to be released once done with frame[] */
+  int result;               /* number of frames loaded (1 for an image), -1 on error */
+  long usecs;               /* time spent loading it, in microseconds */
+};
+
+/* maps an asset pack, whose assets are used from now on instead of the
+ * embedded ones. must be called before any other asset function. returns
+ * 0 on success, -1 if the pack can't be opened or is damaged. */
+int openassetpack(char *file);
+
+/* returns an asset ("tiles", "possum_left", "possum_right", "bg"...),
+ * loading it if needed, or NULL on error. the asset must be given back
+ * with releaseasset() once not needed anymore. thread safe. */
+struct asset *getasset(char *name);
+
+/* gives back an asset obtained from getasset() */
+void releaseasset(struct asset *asset);
+
+/* sets the memory budget of decoded assets, in bytes. assets in use are
+ * never freed, so it may be exceeded if they don't fit. */
+void setassetbudget(long bytes);
+
+/* frees all the decoded assets nobody uses, whatever the budget, even the
+ * ones that cost nothing (frames pointing to the pixels of the binary or
+ * of the pack). meant for shutdown, once all assets have been released. */
+void freeassets(void);
+
+/* prepares a job for loadassets(): a sheet to load into frame[], or an
+ * image to load into frame[0] (maxframes being 1) */
+void setassetjob(struct assetjob *job, char *name, SDL_Surface **frame, int maxframes);
+
+/* loads all the assets of job[] in parallel, on up to threads threads (0
+ * for as many as there are processors), and returns once they are all
+ * loaded. returns 0 on success, -1 if any of them failed. */
+int loadassets(struct assetjob *job, int count, int threads);
+
+/* development mode: from now on, assets are loaded from their PNG file in
+ * dir when there is one, rather than from the pack or the binary, and
+ * these files are watched. must be called before any asset is loaded.
+ * returns 0 on success, -1 if files can't be watched. */
+int watchassets(char *dir);
+
+/* stops watching the files of the assets */
+void unwatchassets(void);
+
+/* returns non-zero if some watched files have been decoded again, and
+ * wait for reloadassets() */
+int assetreloadpending(void);
+
+/* swaps in the assets decoded again since last time, building their
+ * mirrors again as well, and updates the frames of the jobs that loaded
+ * them. the old frames are freed: meant to be called between two frames,
+ * when nothing uses them. returns the number of assets that changed. */
+int reloadassets(struct assetjob *job, int count);
+
+#endif
@@ -0,0 +1,223 @@
+/* texture atlas of Mike O'Possum */
+
+#include <stdlib.h>         /* qsort() */
+#include <string.h>         /* memset(), memcpy(), memmove() */
+#include <SDL/SDL.h>
+
+#include "assets.h"         /* ASSET_*MASK */
+#include "registry.h"       /* memory accounting */
+#include "atlas.h"
+
+
+/* a horizontal segment of the skyline: what is placed on the page covers
+ * [x, x + w) from the top down to y */
+struct skylinenode {
+  int x;
+  int y;
+  int w;
+};
+
+struct skyline {
+  struct skylinenode node[ATLAS_MAXITEMS + 1];
+  int count;
+};
+
+struct atlasitem {
+  int index;
+  int w;
+  int h;
+};
+
+
+/* tallest first, then widest first */
+static int compareitems(const void *a, const void *b) {
+  const struct atlasitem *ia = a, *ib = b;
+  if (ia->h != ib->h) return(ib->h - ia->h);
+  if (ia->w != ib->w) return(ib->w - ia->w);
+  return(ia->index - ib->index);
+}
+
+
+static void skyline_init(struct skyline *sky) {
+  sky->node[0].x = 0;
+  sky->node[0].y = 0;
+  sky->node[0].w = ATLAS_PAGEW;
+  sky->count = 1;
+}
+
+
+/* returns the y where a w x h rectangle would go if its left edge sat at
+ * the start of node i, or -1 if it doesn't fit there */
+static int skyline_fit(struct skyline *sky, int i, int w, int h) {
+  int y = 0, left = w;
+  if (sky->node[i].x + w > ATLAS_PAGEW) return(-1);
+  while (left > 0) {
+    if (sky->node[i].y > y) y = sky->node[i].y;
+    if (y + h > ATLAS_PAGEH) return(-1);
+    left -= sky->node[i].w;
+    i++;
+  }
+  return(y);
+}
+
+
+/* finds the best place for a w x h rectangle: where its bottom edge is
+ * the highest, then the leftmost. returns -1 if it doesn't fit. */
+static int skyline_find(struct skyline *sky, int w, int h, int *x, int *y) {
+  int i, fy, best = -1, besty = 0;
+  for (i = 0; i < sky->count; i++) {
+    fy = skyline_fit(sky, i, w, h);
+    if (fy < 0) continue;
+    if ((best < 0) || (fy < besty)) {
+      best = i;
+      besty = fy;
+    }
+  }
+  if (best < 0) return(-1);
+  *x = sky->node[best].x;
+  *y = besty;
+  return(best);
+}
+
+
+/* raises the skyline where a w x h rectangle was placed at (x,y), on the
+ * node i */
+static void skyline_add(struct skyline *sky, int i, int x, int y, int w, int h) {
+  int j, shrink;
+  memmove(&sky->node[i + 1], &sky->node[i], (sky->count - i) * sizeof(struct skylinenode));
+  sky->count++;
+  sky->node[i].x = x;
+  sky->node[i].y = y + h;
+  sky->node[i].w = w;
+  /* the nodes under the new one are shortened, or go away */
+  for (j = i + 1; j < sky->count; j++) {
+    shrink = sky->node[i].x + sky->node[i].w - sky->node[j].x;
+    if (shrink <= 0) break;
+    sky->node[j].x += shrink;
+    sky->node[j].w -= shrink;
+    if (sky->node[j].w > 0) break;
+    memmove(&sky->node[j], &sky->node[j + 1], (sky->count - j - 1) * sizeof(struct skylinenode));
+    sky->count--;
+    j--;
+  }
+  /* neighbours at the same height become one */
+  for (j = 0; j < sky->count - 1; j++) {
+    if (sky->node[j].y != sky->node[j + 1].y) continue;
+    sky->node[j].w += sky->node[j + 1].w;
+    memmove(&sky->node[j + 1], &sky->node[j + 2], (sky->count - j - 2) * sizeof(struct skylinenode));
+    sky->count--;
+    j--;
+  }
+}
+
+
+/* copies the pixels of a surface to (x,y) on a page, as they are: a blit
+ * would blend them with the empty page instead */
+static void copypixels(SDL_Surface *page, SDL_Surface *src, int x, int y) {
+  int row;
+  SDL_LockSurface(src);
+  SDL_LockSurface(page);
+  for (row = 0; row < src->h; row++) {
+    memcpy((Uint8 *)page->pixels + (y + row) * page->pitch + x * 4, (Uint8 *)src->pixels + row * src->pitch, src->w * 4);
+  }
+  SDL_UnlockSurface(page);
+  SDL_UnlockSurface(src);
+}
+
+
+static int packable(SDL_Surface *s) {
+  if ((s->format->BitsPerPixel != 32) || (s->w > ATLAS_PAGEW) || (s->h > ATLAS_PAGEH)) return(0);
+  if ((s->format->Rmask != ASSET_RMASK) || (s->format->Gmask != ASSET_GMASK) || (s->format->Bmask != ASSET_BMASK) || (s->format->Amask != ASSET_AMASK)) return(0);
+  return(1);
+}
+
+
+int atlas_pack(struct atlas *atlas, SDL_Surface **item, int count, struct atlasregion *region) {
+  struct skyline sky[ATLAS_MAXPAGES];
+  struct atlasitem order[ATLAS_MAXITEMS];
+  int i, p, n, x = 0, y = 0, node, packed = 0;
+
+  memset(atlas, 0, sizeof(*atlas));
+  /* every region starts as the surface itself, in case it isn't packed */
+  n = 0;
+  for (i = 0; i < count; i++) {
+    region[i].surface = item[i];
+    memset(&region[i].rect, 0, sizeof(SDL_Rect));
+    if (item[i] == NULL) continue;
+    region[i].rect.w = item[i]->w;
+    region[i].rect.h = item[i]->h;
+    if ((n < ATLAS_MAXITEMS) && (packable(item[i]) != 0)) {
+      order[n].index = i;
+      order[n].w = item[i]->w;
+      order[n].h = item[i]->h;
+      n++;
+    }
+  }
+  qsort(order, n, sizeof(struct atlasitem), compareitems);
+
+  for (i = 0; i < n; i++) {
+    /* on the first page it fits on, or on a new one */
+    node = -1;
+    for (p = 0; p < atlas->pagecount; p++) {
+      node = skyline_find(&sky[p], order[i].w, order[i].h, &x, &y);
+      if (node >= 0) break;
+    }
+    if (node < 0) {
+      if (atlas->pagecount == ATLAS_MAXPAGES) continue;
+      p = atlas->pagecount;
+      atlas->page[p] = SDL_CreateRGBSurface(SDL_SWSURFACE | SDL_SRCALPHA, ATLAS_PAGEW, ATLAS_PAGEH, 32, ASSET_RMASK, ASSET_GMASK, ASSET_BMASK, ASSET_AMASK);
+      if (atlas->page[p] == NULL) break;
+      registry_addsurface(atlas->page[p], "atlas page", "atlas");
+      SDL_FillRect(atlas->page[p], NULL, 0x0);
+      atlas->pagecount++;
+      skyline_init(&sky[p]);
+      node = skyline_find(&sky[p], order[i].w, order[i].h, &x, &y);
+    }
+    skyline_add(&sky[p], node, x, y, order[i].w, order[i].h);
+    copypixels(atlas->page[p], item[order[i].index], x, y);
+    region[order[i].index].surface = atlas->page[p];
+    region[order[i].index].rect.x = x;
+    region[order[i].index].rect.y = y;
+    packed++;
+  }
+  return(packed);
+}
+
+
+void atlas_displayformat(struct atlas *atlas, struct atlasregion *region, int count) {
+  SDL_Surface *screen, *page;
+  int p, i;
+  screen = SDL_GetVideoSurface();
+  if (screen == NULL) return;
+  /* remembered even if some page fails to convert, so it isn't tried
+   * again and again */
+  atlas->screenbpp = screen->format->BitsPerPixel;
+  atlas->screenrmask = screen->format->Rmask;
+  atlas->screengmask = screen->format->Gmask;
+  atlas->screenbmask = screen->format->Bmask;
+  for (p = 0; p < atlas->pagecount; p++) {
+    page = registry_addsurface(SDL_DisplayFormatAlpha(atlas->page[p]), "atlas page", "atlas");
+    if (page == NULL) continue;
+    for (i = 0; i < count; i++) {
+      if (region[i].surface == atlas->page[p]) region[i].surface = page;
+    }
+    registry_freesurface(atlas->page[p]);
+    atlas->page[p] = page;
+  }
+}
+
+
+int atlas_isdisplayformat(struct atlas *atlas) {
+  SDL_Surface *screen;
+  screen = SDL_GetVideoSurface();
+  if (screen == NULL) return(0);
+  if ((screen->format->BitsPerPixel != atlas->screenbpp) || (screen->format->Rmask != atlas->screenrmask) || (screen->format->Gmask != atlas->screengmask) || (screen->format->Bmask != atlas->screenbmask)) return(0);
+  return(1);
+}
+
+
+void atlas_free(struct atlas *atlas) {
+  int i;
+  for (i = 0; i < atlas->pagecount; i++) registry_freesurface(atlas->page[i]);
+  atlas->pagecount = 0;
+}
@@ -0,0 +1,63 @@
+/* texture atlas of Mike O'Possum
+ *
+ * Packs many small surfaces (tiles, frames of sprites) into a few large
+ * ones, the pages, so what is drawn every frame sits in a handful of big
+ * blocks of memory instead of dozens of small ones. Each packed surface
+ * gets a region: the page it was copied to, and where on that page.
+ *
+ * Packing is done with a skyline bottom-left packer: the top edge of what
+ * is already placed on a page is kept as a list of horizontal segments,
+ * and each rectangle goes where its bottom edge stays closest to the top
+ * of the page, leftmost on a tie. Rectangles are placed tallest first,
+ * which keeps the skyline flat and the waste low.
+ *
+ * Pages start in the 32 bits format of the sprite sheets, and are better
+ * converted to the format of the screen once packed, so blits from them
+ * are plain copies rather than a conversion of every pixel. */
+
+#ifndef ATLAS_H_SENTINEL
+#define ATLAS_H_SENTINEL
+
+#include <SDL/SDL.h>
+
+#define ATLAS_PAGEW 512
+#define ATLAS_PAGEH 512
+#define ATLAS_MAXPAGES 8
+#define ATLAS_MAXITEMS 256
+
+/* where a surface is to be blitted from */
+struct atlasregion {
+  SDL_Surface *surface;     /* a page of the atlas, or the surface itself if it wasn't packed */
+  SDL_Rect rect;
+};
+
+struct atlas {
+  SDL_Surface *page[ATLAS_MAXPAGES];
+  int pagecount;
+  Uint8 screenbpp;          /* format of the screen the pages were converted for, 0 if they weren't */
+  Uint32 screenrmask;
+  Uint32 screengmask;
+  Uint32 screenbmask;
+};
+
+/* copies the count surfaces of item[] to the pages of a new atlas, and
+ * stores where each of them went in region[]. surfaces that can't be
+ * packed (not in the 32 bits format of the sheets, too large for a page,
+ * no memory left...) are left alone, their region being the whole surface
+ * itself, so region[] is always usable. NULL items are skipped. returns
+ * the number of surfaces packed. */
+int atlas_pack(struct atlas *atlas, SDL_Surface **item, int count, struct atlasregion *region);
+
+/* converts the pages of an atlas to the format of the screen, keeping
+ * their alpha, and points the count regions of region[] that were on the
+ * old pages to the new ones. pages that can't be converted are kept. */
+void atlas_displayformat(struct atlas *atlas, struct atlasregion *region, int count);
+
+/* returns non-zero if the pages of an atlas were converted for the
+ * current video mode */
+int atlas_isdisplayformat(struct atlas *atlas);
+
+/* frees the pages of an atlas */
+void atlas_free(struct atlas *atlas);
+
+#endif
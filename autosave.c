@@ -0,0 +1,185 @@
+/* autosave of the level editor */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), free() */
+#include <string.h>         /* memcpy() */
+#include <unistd.h>         /* unlink() */
+#include <pthread.h>
+#include <sys/stat.h>       /* stat() */
+#include <time.h>           /* clock_gettime() */
+
+#include "level.h"
+#include "autosave.h"
+
+
+/* copies the chunk (cx,cy) of the tilemap from src to dst */
+static void copychunk(struct worldstruct *dst, struct worldstruct *src, int cx, int cy) {
+  int x, y = cy * LEVEL_CHUNKH, h = LEVEL_CHUNKH;
+  if (y + h > WORLD_MAXH) h = WORLD_MAXH - y;
+  /* a column of a chunk is contiguous in the tilemap */
+  for (x = cx * LEVEL_CHUNKW; (x < (cx + 1) * LEVEL_CHUNKW) && (x < WORLD_MAXW); x++) {
+    memcpy(&(dst->tilemap[x][y][0]), &(src->tilemap[x][y][0]), h * WORLD_LAYERS * sizeof(src->tilemap[0][0][0]));
+  }
+}
+
+
+/* copies what is not part of the tilemap: size and objects */
+static void copyheader(struct worldstruct *dst, struct worldstruct *src) {
+  dst->width = src->width;
+  dst->height = src->height;
+  dst->objectcount = src->objectcount;
+  memcpy(dst->objects, src->objects, src->objectcount * sizeof(src->objects[0]));
+}
+
+
+static void *autosave_thread(void *arg) {
+  struct autosave *as = arg;
+  unsigned char *image;
+  long len;
+  int cx, cy;
+  pthread_mutex_lock(&as->lock);
+  for (;;) {
+    if (as->pending != 0) {
+        /* bring our copy up to date with the chunks that changed, then
+         * compress and write it without holding the lock */
+        as->pending = 0;
+        for (cx = 0; cx < AUTOSAVE_COLS; cx++) {
+          for (cy = 0; cy < AUTOSAVE_ROWS; cy++) {
+            if (as->copyversion[cx][cy] == as->version[cx][cy]) continue;
+            copychunk(as->copy, as->snapshot, cx, cy);
+            as->copyversion[cx][cy] = as->version[cx][cy];
+          }
+        }
+        copyheader(as->copy, as->snapshot);
+        pthread_mutex_unlock(&as->lock);
+        image = packlevel(as->copy, &len);
+        if ((image == NULL) || (writefileatomic(as->file, image, len) != 0)) printf("Failed to autosave to %s!\n", as->file);
+        free(image);
+        pthread_mutex_lock(&as->lock);
+      } else if (as->discard != 0) {
+        as->discard = 0;
+        unlink(as->file);
+      } else if (as->quit != 0) {
+        break;
+      } else {
+        pthread_cond_wait(&as->cond, &as->lock);
+    }
+  }
+  pthread_mutex_unlock(&as->lock);
+  return(NULL);
+}
+
+
+int autosave_recover(char *file, struct worldstruct *world) {
+  struct stat filest, autost;
+  char autofile[256 + 16];
+  if (strlen(file) >= 256) return(-1);
+  sprintf(autofile, "%s.autosave", file);
+  if (stat(autofile, &autost) != 0) return(-1);
+  if ((stat(file, &filest) == 0) && (filest.st_mtime >= autost.st_mtime)) return(-1); /* saved since */
+  return(loadlevel(autofile, world));
+}
+
+
+struct autosave *autosave_start(char *file, struct worldstruct *world) {
+  struct autosave *as;
+  if (strlen(file) >= 256) return(NULL);
+  as = malloc(sizeof(struct autosave));
+  if (as == NULL) return(NULL);
+  memset(as, 0, sizeof(struct autosave));
+  sprintf(as->file, "%s.autosave", file);
+  as->snapshot = malloc(sizeof(struct worldstruct));
+  as->copy = malloc(sizeof(struct worldstruct));
+  if ((as->snapshot == NULL) || (as->copy == NULL)) {
+    free(as->snapshot);
+    free(as->copy);
+    free(as);
+    return(NULL);
+  }
+  /* both copies start identical to the world, all chunks at version 0 */
+  memcpy(as->snapshot->tilemap, world->tilemap, sizeof(world->tilemap));
+  memcpy(as->copy->tilemap, world->tilemap, sizeof(world->tilemap));
+  copyheader(as->snapshot, world);
+  copyheader(as->copy, world);
+  pthread_mutex_init(&as->lock, NULL);
+  pthread_cond_init(&as->cond, NULL);
+  if (pthread_create(&as->thread, NULL, autosave_thread, as) != 0) {
+    pthread_mutex_destroy(&as->lock);
+    pthread_cond_destroy(&as->cond);
+    free(as->snapshot);
+    free(as->copy);
+    free(as);
+    return(NULL);
+  }
+  return(as);
+}
+
+
+void autosave_touch(struct autosave *as, int x, int y) {
+  if (as == NULL) return;
+  if ((x < 0) || (y < 0) || (x >= WORLD_MAXW) || (y >= WORLD_MAXH)) return;
+  as->dirty[x / LEVEL_CHUNKW][y / LEVEL_CHUNKH] = 1;
+  if (as->changed == 0) {
+    as->changed = 1;
+    clock_gettime(CLOCK_MONOTONIC, &as->changetime);
+  }
+}
+
+
+long autosave_due(struct autosave *as) {
+  struct timespec now;
+  long elapsed;
+  if ((as == NULL) || (as->changed == 0)) return(-1);
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  elapsed = (now.tv_sec - as->changetime.tv_sec) * 1000 + (now.tv_nsec - as->changetime.tv_nsec) / 1000000;
+  if (elapsed >= AUTOSAVE_DELAY * 1000) return(0);
+  return(AUTOSAVE_DELAY * 1000 - elapsed);
+}
+
+
+void autosave_snapshot(struct autosave *as, struct worldstruct *world) {
+  int cx, cy;
+  if (as == NULL) return;
+  pthread_mutex_lock(&as->lock);
+  for (cx = 0; cx < AUTOSAVE_COLS; cx++) {
+    for (cy = 0; cy < AUTOSAVE_ROWS; cy++) {
+      if (as->dirty[cx][cy] == 0) continue;
+      copychunk(as->snapshot, world, cx, cy);
+      as->version[cx][cy]++;
+      as->dirty[cx][cy] = 0;
+    }
+  }
+  copyheader(as->snapshot, world);
+  as->pending = 1;
+  as->discard = 0;
+  pthread_cond_signal(&as->cond);
+  pthread_mutex_unlock(&as->lock);
+  as->changed = 0;
+}
+
+
+void autosave_saved(struct autosave *as) {
+  if (as == NULL) return;
+  /* the dirty chunks are kept: they still differ from the snapshot */
+  as->changed = 0;
+  pthread_mutex_lock(&as->lock);
+  as->pending = 0;
+  as->discard = 1;
+  pthread_cond_signal(&as->cond);
+  pthread_mutex_unlock(&as->lock);
+}
+
+
+void autosave_stop(struct autosave *as) {
+  if (as == NULL) return;
+  pthread_mutex_lock(&as->lock);
+  as->quit = 1;
+  pthread_cond_signal(&as->cond);
+  pthread_mutex_unlock(&as->lock);
+  pthread_join(as->thread, NULL);
+  pthread_mutex_destroy(&as->lock);
+  pthread_cond_destroy(&as->cond);
+  free(as->snapshot);
+  free(as->copy);
+  free(as);
+}
@@ -0,0 +1,70 @@
+/* autosave of the level editor
+ *
+ * The world being edited is periodically saved next to its file, as
+ * <file>.autosave, so that a crash loses at most a few seconds of work.
+ *
+ * The UI thread only takes a snapshot of the world: it copies the chunks
+ * modified since the previous snapshot (see autosave_touch()) into a shadow
+ * world, which costs O(changes) and never touches the disk. A background
+ * thread then brings its own copy up to date with the chunks whose version
+ * changed, and compresses and writes it without holding any lock. */
+
+#ifndef AUTOSAVE_H_SENTINEL
+#define AUTOSAVE_H_SENTINEL
+
+#include <pthread.h>
+#include <time.h>
+
+#include "level.h"
+
+#define AUTOSAVE_DELAY 10   /* seconds between a modification and its autosave */
+#define AUTOSAVE_COLS ((WORLD_MAXW + LEVEL_CHUNKW - 1) / LEVEL_CHUNKW)
+#define AUTOSAVE_ROWS ((WORLD_MAXH + LEVEL_CHUNKH - 1) / LEVEL_CHUNKH)
+
+struct autosave {
+  char file[256 + 16];      /* the autosave file */
+  /* owned by the UI thread */
+  unsigned char dirty[AUTOSAVE_COLS][AUTOSAVE_ROWS]; /* chunks modified since the last snapshot */
+  int changed;              /* there are modifications not autosaved (nor saved) yet */
+  struct timespec changetime; /* when the oldest of these modifications happened */
+  /* shared, protected by lock */
+  struct worldstruct *snapshot;
+  unsigned long version[AUTOSAVE_COLS][AUTOSAVE_ROWS]; /* of each chunk of the snapshot */
+  int pending;              /* the snapshot has to be written */
+  int discard;              /* the autosave file has to be removed */
+  int quit;
+  /* owned by the background thread */
+  struct worldstruct *copy; /* what is being written */
+  unsigned long copyversion[AUTOSAVE_COLS][AUTOSAVE_ROWS];
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+};
+
+/* if the autosave of file is more recent than file itself (or if file does
+ * not exist), loads it into world. returns 0 if world has been recovered
+ * from the autosave, -1 otherwise. */
+int autosave_recover(char *file, struct worldstruct *world);
+
+/* starts autosaving world, loaded from file. returns NULL on failure. all
+ * other functions accept a NULL autosave and then do nothing. */
+struct autosave *autosave_start(char *file, struct worldstruct *world);
+
+/* tells that the tile (x,y) of the world has been modified */
+void autosave_touch(struct autosave *as, int x, int y);
+
+/* returns how many milliseconds are left before autosave_snapshot() should
+ * be called, 0 if it is due, or -1 if there is nothing to autosave */
+long autosave_due(struct autosave *as);
+
+/* copies the modified parts of world and hands them to the background thread */
+void autosave_snapshot(struct autosave *as, struct worldstruct *world);
+
+/* tells that world has been saved to its file: the autosave is not needed
+ * anymore and gets removed */
+void autosave_saved(struct autosave *as);
+
+/* stops the background thread, after it is done with the pending work */
+void autosave_stop(struct autosave *as);
+
+#endif
@@ -1,257 +1,1163 @@
 /* level editor for Mike O'Possum */
 
 #include <stdio.h>
-#include <unistd.h>  /* usleep() */
+#include <stdlib.h>  /* malloc(), free() */
+#include <string.h>  /* strcmp() */
 #include <SDL/SDL.h>
-#include <SDL/SDL_image.h>  /* SDL_image */
 
-#include "sprites.h"
+#include "level.h"
+#include "undo.h"
+#include "paint.h"
+#include "autosave.h"
+#include "minimap.h"
+#include "stamp.h"
+#include "engine.h"
+#include "assets.h"
+#include "registry.h"
 
-struct spritesstruct {
-  SDL_Surface *player[2][8];
+#define EDIT_MAXDIRTY 64
+#define EDIT_ZOOMLEVELS 3 /* 1:1, 1:2 and 1:4 */
+
+/* what a click on the map does */
+enum edittool {
+  TOOL_PEN = 0,   /* paints the cells under the mouse while the button is down */
+  TOOL_FILL,      /* flood fills the area under the mouse */
+  TOOL_RECT,      /* fills the rectangle between where the button is pressed and released */
+  TOOL_LINE,      /* draws a line between where the button is pressed and released */
+  TOOL_SELECT,    /* selects the rectangle between where the button is pressed and released */
+  TOOL_PASTE      /* pastes the clipboard, its top left corner under the mouse */
+};
+
+/* icons of the navigation column, from its top row down */
+enum navicon {
+  NAV_UP = 0,
+  NAV_DOWN,
+  NAV_LEFT,
+  NAV_RIGHT,
+  NAV_ZOOMIN,
+  NAV_ZOOMOUT,
+  NAV_ICONS
+};
+
+struct editsprites {
   SDL_Surface *tiles[64];
+  SDL_Surface *zoomed[EDIT_ZOOMLEVELS][64]; /* tiles shrunk by 2^level ([0] at 1:1), in the format of the screen */
   int tilescount;
 };
 
-struct worldstruct {
-  int width;
-  int height;
-  int tilemap[64][64][4]; /* x, y, z */
-  SDL_Surface *bg;
+/* the state of the editor */
+struct editstate {
+  int viewmode;             /* 0..3 = only this layer is displayed and edited, 4 = all layers are displayed */
+  int controlcolumn;        /* screen column (in tiles) of the tiles palette, the navigation icons are on its left */
+  int selectedtile;
+  int selectedtile_offset;  /* first tile displayed in the palette */
+  int painting;             /* 1 = painting with the pen, 2 = waiting for the end of a rectangle or line, 3 = selecting */
+  enum edittool tool;
+  int toolx;                /* map cell where the rectangle or line tool started */
+  int tooly;
+  int penx;                 /* last map cell painted by the pen during this stroke, -1 if none */
+  int peny;
+  int cursorx;              /* map cell the cursor is drawn on, -1 if not drawn */
+  int cursory;
+  int cursorscreenx;        /* screen cell the cursor is drawn on, if it is over the palette */
+  int cursorscreeny;
+  int viewx;                /* map cell shown at the bottom left corner of the map area */
+  int viewy;
+  int zoom;                 /* 0 = 1:1, 1 = 1:2, 2 = 1:4 */
+  int cellw;                /* size of a map cell on screen, at the current zoom */
+  int cellh;
+  SDL_Surface *mapcache;    /* the whole map, composed for the current view mode and zoom */
+  SDL_Rect dirty[EDIT_MAXDIRTY]; /* parts of the screen to push to the display, see adddirty() */
+  int dirtycount;           /* -1 = the whole screen is dirty */
+  struct undojournal *undo;
+  struct autosave *autosave;
+  struct minimap minimap;
+  int showminimap;          /* the minimap is drawn over the top right corner of the map area */
+  int selection;            /* non-zero if there is a selection, between the (selx1,sely1) and (selx2,sely2) cells */
+  int selx1;
+  int sely1;
+  int selx2;
+  int sely2;
+  struct stamp clipboard;
+  int overlayx1;            /* cells covered by the overlay (selection outline or paste preview) on screen, overlayx2 < 0 if none */
+  int overlayy1;
+  int overlayx2;
+  int overlayy2;
+  int overlaydamaged;       /* something may have been drawn over the overlay */
 };
 
+/* what the undo journal and the painting tools need to record and redraw
+ * the cells they modify */
+struct editctx {
+  struct editstate *ed;
+  SDL_Surface *screen;
+  struct editsprites *sprites;
+  struct worldstruct *world;
+  int minx;                 /* bounding box of the cells modified by the last tool */
+  int miny;
+  int maxx;
+  int maxy;
+};
 
 
-static SDL_Surface *loadGraphic(void *memptr, int memlen) {
+/* returns a copy of a tile in the format of the screen, so drawing it
+ * is a plain copy, and frees the tile if it was a copy already. returns
+ * the tile itself if it can't be converted. */
+static SDL_Surface *displaytile(SDL_Surface *tile, int owned) {
   SDL_Surface *result;
-  SDL_RWops *rwop;
-  rwop = SDL_RWFromMem(memptr, memlen);
-  result = IMG_LoadPNG_RW(rwop);
-  SDL_FreeRW(rwop);
+  if (tile == NULL) return(NULL);
+  result = registry_addsurface(SDL_DisplayFormatAlpha(tile), "zoomed tile", "editor");
+  if (result == NULL) return(tile);
+  if (owned != 0) registry_freesurface(tile);
   return(result);
 }
 
 
-static void loadSpriteSheet(SDL_Surface **surface, int width, int height, int itemcount, void *memptr, int memlen) {
-  SDL_Surface *spritesheet;
-  SDL_Rect rect;
-  int i;
-  spritesheet = loadGraphic(memptr, memlen);
-  for (i = 0; i < itemcount; i++) {
-    rect.x = i * width;
-    rect.y = 0;
-    rect.w = width;
-    rect.h = height;
-    surface[i] = SDL_CreateRGBSurface(SDL_SWSURFACE | SDL_SRCALPHA, width, height, 32, 0xFF000000L, 0x00FF0000L, 0x0000FF00L, 0x000000FFL);  /* I'm setting alpha to 0, because otherwise sdl for some strange reason uses the destination alpha mask :/ */
-    SDL_FillRect(surface[i], NULL, 0x0);
-    SDL_BlitSurface(spritesheet, &rect, surface[i], NULL);
+/* returns a copy of the tile shrunk by 2^shift, each pixel being the
+ * average of the square of pixels it replaces */
+static SDL_Surface *shrinktile(SDL_Surface *tile, int shift) {
+  SDL_Surface *result;
+  Uint32 *row;
+  Uint8 r, g, b, a;
+  unsigned long sum[4], wsum[3];
+  int x, y, i, j, n = 1 << shift;
+  result = SDL_CreateRGBSurface(SDL_SWSURFACE | SDL_SRCALPHA, tile->w >> shift, tile->h >> shift, 32, 0xFF000000L, 0x00FF0000L, 0x0000FF00L, 0x000000FFL);
+  if (result == NULL) return(NULL);
+  registry_addsurface(result, "zoomed tile", "editor");
+  SDL_LockSurface(tile);
+  SDL_LockSurface(result);
+  for (y = 0; y < result->h; y++) {
+    for (x = 0; x < result->w; x++) {
+      memset(sum, 0, sizeof(sum));
+      memset(wsum, 0, sizeof(wsum));
+      for (j = 0; j < n; j++) {
+        row = (Uint32 *)((Uint8 *)tile->pixels + (y * n + j) * tile->pitch);
+        for (i = 0; i < n; i++) {
+          SDL_GetRGBA(row[x * n + i], tile->format, &r, &g, &b, &a);
+          sum[0] += r;
+          sum[1] += g;
+          sum[2] += b;
+          sum[3] += a;
+          /* colors weighted by alpha, so transparent pixels don't bleed into the result */
+          wsum[0] += r * a;
+          wsum[1] += g * a;
+          wsum[2] += b * a;
+        }
+      }
+      if (sum[3] > 0) {
+        r = wsum[0] / sum[3];
+        g = wsum[1] / sum[3];
+        b = wsum[2] / sum[3];
+      } else {
+        r = sum[0] / (n * n);
+        g = sum[1] / (n * n);
+        b = sum[2] / (n * n);
+      }
+      row = (Uint32 *)((Uint8 *)result->pixels + y * result->pitch);
+      row[x] = SDL_MapRGBA(result->format, r, g, b, sum[3] / (n * n));
+    }
   }
-  SDL_FreeSurface(spritesheet);
+  SDL_UnlockSurface(result);
+  SDL_UnlockSurface(tile);
+  return(result);
 }
 
 
-void drawscreen(SDL_Surface *screen, struct spritesstruct *sprites, struct worldstruct *world, int controlcolumn, int selectedtile, int selectedtile_offset, int viewmode) {
-  SDL_Rect rect;
-  int x, y, z;
+/* returns the white color in the format of the given surface */
+static Uint32 white(SDL_Surface *surface) {
+  return(SDL_MapRGB(surface->format, 0xFF, 0xFF, 0xFF));
+}
+
+
+/* queues a part of the screen to be refreshed by flushdirty() */
+static void adddirty(struct editstate *ed, SDL_Surface *screen, int x, int y, int w, int h) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > screen->w) w = screen->w - x;
+  if (y + h > screen->h) h = screen->h - y;
+  if ((w <= 0) || (h <= 0) || (ed->dirtycount < 0)) return;
+  if (ed->dirtycount == EDIT_MAXDIRTY) { /* too many rects, refresh the whole screen instead */
+    ed->dirtycount = -1;
+    return;
+  }
+  ed->dirty[ed->dirtycount].x = x;
+  ed->dirty[ed->dirtycount].y = y;
+  ed->dirty[ed->dirtycount].w = w;
+  ed->dirty[ed->dirtycount].h = h;
+  ed->dirtycount++;
+}
+
 
-  SDL_FillRect(screen, NULL, 0xFFFFFF); /* fill the screen with black */
-  if (world->bg != NULL) SDL_BlitSurface(world->bg, NULL, screen, NULL); /* apply the background image, if any */
+/* pushes all dirty parts of the screen to the display */
+static void flushdirty(struct editstate *ed, SDL_Surface *screen) {
+  if (ed->dirtycount < 0) {
+      SDL_UpdateRect(screen, 0, 0, 0, 0);
+    } else if (ed->dirtycount > 0) {
+      SDL_UpdateRects(screen, ed->dirtycount, ed->dirty);
+  }
+  ed->dirtycount = 0;
+}
+
+
+/* waits for an event, for at most timeout ms (forever if timeout is
+ * negative). returns 1 if an event has been stored in event, 0 on timeout.
+ * SDL 1.2 has no SDL_WaitEventTimeout(), so a finite timeout is emulated
+ * by polling. */
+static int waitevent(SDL_Event *event, int timeout) {
+  Uint32 start;
+  if (timeout < 0) return(SDL_WaitEvent(event));
+  start = SDL_GetTicks();
+  for (;;) {
+    if (SDL_PollEvent(event) != 0) return(1);
+    if (SDL_GetTicks() - start >= (Uint32)timeout) return(0);
+    SDL_Delay(5);
+  }
+}
 
-  /* draw all the background */
+
+/* returns the width of the map area on screen, in pixels */
+static int mapareawidth(struct editstate *ed, struct editsprites *sprites) {
+  return((ed->controlcolumn - 1) * sprites->tiles[0]->w);
+}
+
+
+/* computes where the map cell (x,y) lands on screen, through the camera.
+ * returns 0 if the cell is entirely visible in the map area, non-zero
+ * otherwise - this is what culls everything outside of the view. */
+static int celltoscreen(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, int x, int y, SDL_Rect *rect) {
+  rect->x = (x - ed->viewx) * ed->cellw;
+  rect->y = screen->h - ((y - ed->viewy + 1) * ed->cellh);
+  rect->w = ed->cellw;
+  rect->h = ed->cellh;
+  if ((x < 0) || (y < 0) || (x >= WORLD_MAXW) || (y >= WORLD_MAXH)) return(-1);
+  if ((rect->x < 0) || (rect->x + rect->w > mapareawidth(ed, sprites))) return(-1);
+  if ((rect->y < 0) || (rect->y + rect->h > screen->h)) return(-1);
+  return(0);
+}
+
+
+/* finds the map cell under the (sx,sy) screen position, through the
+ * camera. returns 0 if it is in the map area, non-zero otherwise. */
+static int screentocell(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, int sx, int sy, int *x, int *y) {
+  if ((sx < 0) || (sx >= mapareawidth(ed, sprites)) || (sy < 0) || (sy >= screen->h)) return(-1);
+  *x = ed->viewx + sx / ed->cellw;
+  *y = ed->viewy + (screen->h - 1 - sy) / ed->cellh;
+  if ((*x >= WORLD_MAXW) || (*y < 0) || (*y >= WORLD_MAXH)) return(-1);
+  return(0);
+}
+
+
+/* composes the map cell (x,y) into the map cache, for the current view
+ * mode and zoom */
+static void rendercell(struct editstate *ed, struct editsprites *sprites, struct worldstruct *world, int x, int y) {
+  SDL_Rect rect, cellrect;
+  int z, t;
+  cellrect.x = x * ed->cellw;
+  cellrect.y = ed->mapcache->h - ((y + 1) * ed->cellh);
+  cellrect.w = ed->cellw;
+  cellrect.h = ed->cellh;
+  rect = cellrect;
+  SDL_FillRect(ed->mapcache, &rect, white(ed->mapcache));
+  for (z = 0; z < WORLD_LAYERS; z++) {
+    if ((ed->viewmode != z) && (ed->viewmode != 4)) continue;
+    t = world->tilemap[x][y][z];
+    if ((t <= 0) || (t >= sprites->tilescount)) continue;
+    rect = cellrect; /* SDL_BlitSurface() may alter the destination rect */
+    SDL_BlitSurface(sprites->zoomed[ed->zoom][t], NULL, ed->mapcache, &rect);
+  }
+}
+
+
+/* (re)builds the whole map cache, for the current view mode and zoom. the
+ * cache is in the screen's format so that copying it to the screen is a
+ * plain blit. */
+static void buildmapcache(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, struct worldstruct *world) {
+  int x, y;
+  if ((ed->mapcache != NULL) && (ed->mapcache->w != WORLD_MAXW * ed->cellw)) { /* zoom changed */
+    registry_freesurface(ed->mapcache);
+    ed->mapcache = NULL;
+  }
+  if (ed->mapcache == NULL) {
+    SDL_PixelFormat *f = screen->format;
+    ed->mapcache = registry_addsurface(SDL_CreateRGBSurface(SDL_SWSURFACE, WORLD_MAXW * ed->cellw, WORLD_MAXH * ed->cellh, f->BitsPerPixel, f->Rmask, f->Gmask, f->Bmask, 0), "map cache", "editor");
+  }
+  SDL_FillRect(ed->mapcache, NULL, white(ed->mapcache));
+  for (x = 0; x < WORLD_MAXW; x++) {
+    for (y = 0; y < WORLD_MAXH; y++) rendercell(ed, sprites, world, x, y);
+  }
+}
+
+
+/* copies the map cell (x,y) from the map cache to the screen */
+static void drawmapcell(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, int x, int y) {
+  SDL_Rect src, dst;
+  if (celltoscreen(ed, screen, sprites, x, y, &dst) != 0) return;
+  src.x = x * ed->cellw;
+  src.y = ed->mapcache->h - ((y + 1) * ed->cellh);
+  src.w = ed->cellw;
+  src.h = ed->cellh;
+  adddirty(ed, screen, dst.x, dst.y, dst.w, dst.h);
+  SDL_BlitSurface(ed->mapcache, &src, screen, &dst);
+  if ((ed->cursorx == x) && (ed->cursory == y)) ed->cursorx = -1; /* the cursor has been overwritten */
+  if ((x >= ed->overlayx1) && (x <= ed->overlayx2) && (y >= ed->overlayy1) && (y <= ed->overlayy2)) ed->overlaydamaged = 1;
+}
+
+
+/* copies the visible part of a rectangle of map cells from the map cache
+ * to the screen, at once */
+static void drawmaprect(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, int x1, int y1, int x2, int y2) {
+  SDL_Rect src, dst;
+  /* clip to the visible cells */
+  if (x1 < ed->viewx) x1 = ed->viewx;
+  if (y1 < ed->viewy) y1 = ed->viewy;
+  if (x2 >= ed->viewx + mapareawidth(ed, sprites) / ed->cellw) x2 = ed->viewx + mapareawidth(ed, sprites) / ed->cellw - 1;
+  if (y2 >= ed->viewy + screen->h / ed->cellh) y2 = ed->viewy + screen->h / ed->cellh - 1;
+  if ((x1 > x2) || (y1 > y2)) return;
+  if (celltoscreen(ed, screen, sprites, x1, y2, &dst) != 0) return; /* top left cell */
+  src.x = x1 * ed->cellw;
+  src.y = ed->mapcache->h - ((y2 + 1) * ed->cellh);
+  src.w = (x2 - x1 + 1) * ed->cellw;
+  src.h = (y2 - y1 + 1) * ed->cellh;
+  adddirty(ed, screen, dst.x, dst.y, src.w, src.h);
+  SDL_BlitSurface(ed->mapcache, &src, screen, &dst);
+  if ((ed->cursorx >= x1) && (ed->cursorx <= x2) && (ed->cursory >= y1) && (ed->cursory <= y2)) ed->cursorx = -1; /* the cursor has been overwritten */
+}
+
+
+/* draws the entry of the tiles palette at the given screen row */
+static void drawpalettecell(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, int row) {
+  SDL_Rect rect;
+  rect.x = ed->controlcolumn * sprites->tiles[0]->w;
+  rect.y = row * sprites->tiles[0]->h;
   rect.w = sprites->tiles[0]->w;
   rect.h = sprites->tiles[0]->h;
-  for (y = 0; y < 64; y++) {
-    rect.y = screen->h - ((y + 1) * sprites->tiles[0]->h);
-    for (x = 0; x < 64; x++) {
-      rect.x = x * sprites->tiles[0]->w;
-      for (z = 0; z < 4; z++) {
-        if ((viewmode == z) || (viewmode == 4)) {
-          if (world->tilemap[x][y][z] > 0) SDL_BlitSurface(sprites->tiles[world->tilemap[x][y][z]], NULL, screen, &rect);
-        }
+  adddirty(ed, screen, rect.x, rect.y, rect.w, rect.h);
+  SDL_FillRect(screen, &rect, white(screen));
+  /* row 0 is the 'scroll up' button, tiles start at row 1 */
+  if ((row > 0) && (row - 1 + ed->selectedtile_offset < sprites->tilescount)) SDL_BlitSurface(sprites->zoomed[0][row - 1 + ed->selectedtile_offset], NULL, screen, &rect);
+}
+
+
+/* draws all available tiles */
+static void drawpalette(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites) {
+  SDL_Rect rect;
+  int row;
+  rect.x = ed->controlcolumn * sprites->tiles[0]->w;
+  rect.y = 0;
+  rect.w = screen->w - rect.x;
+  rect.h = screen->h;
+  SDL_FillRect(screen, &rect, white(screen));
+  for (row = 0; row * sprites->tiles[0]->h < screen->h; row++) drawpalettecell(ed, screen, sprites, row);
+  adddirty(ed, screen, rect.x, rect.y, rect.w, rect.h);
+}
+
+
+/* draws the icons of the navigation column: a black arrow pointing
+ * up, down, left or right, or a plus or a minus sign for zooming */
+static void drawnavigation(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites) {
+  SDL_Rect rect, line;
+  Uint32 black = SDL_MapRGB(screen->format, 0, 0, 0);
+  int icon, i, w = sprites->tiles[0]->w, h = sprites->tiles[0]->h;
+  rect.x = (ed->controlcolumn - 1) * w;
+  rect.y = 0;
+  rect.w = w;
+  rect.h = screen->h;
+  SDL_FillRect(screen, &rect, white(screen));
+  adddirty(ed, screen, rect.x, rect.y, rect.w, rect.h);
+  for (icon = 0; icon < NAV_ICONS; icon++) {
+    rect.y = icon * h;
+    /* arrows are drawn one line at a time, growing from their tip */
+    for (i = 0; i < w / 2 - 2; i++) {
+      switch (icon) {
+        case NAV_UP:
+        case NAV_DOWN:
+          line.x = rect.x + w / 2 - 1 - i;
+          line.y = rect.y + 4 + ((icon == NAV_UP) ? i : h / 2 - 1 - i);
+          line.w = 2 * (i + 1);
+          line.h = 1;
+          break;
+        case NAV_LEFT:
+        case NAV_RIGHT:
+          line.x = rect.x + 4 + ((icon == NAV_LEFT) ? i : w / 2 - 1 - i);
+          line.y = rect.y + h / 2 - 1 - i;
+          line.w = 1;
+          line.h = 2 * (i + 1);
+          break;
+        default:
+          line.w = 0;
+          break;
       }
+      if (line.w > 0) SDL_FillRect(screen, &line, black);
     }
-  }
-
-  /* draw all available tiles */
-  for (x = 0; x < sprites->tilescount; x++) {
-    rect.x = controlcolumn * sprites->tiles[0]->w;
-    rect.y = (x + 1) * sprites->tiles[0]->h;
-    SDL_BlitSurface(sprites->tiles[x + selectedtile_offset], NULL, screen, &rect);
-    if (rect.y > screen->h) break;
-  }
-
-  /* draw the cursor */
-  SDL_GetMouseState(&x, &y);
-  x /= sprites->tiles[0]->w;
-  y /= sprites->tiles[0]->h;
-  rect.x = x * sprites->tiles[0]->w;
-  rect.y = y * sprites->tiles[0]->h;
-  if (x != controlcolumn) SDL_BlitSurface(sprites->tiles[selectedtile], NULL, screen, &rect);
-  SDL_BlitSurface(sprites->tiles[17], NULL, screen, &rect);
-
-  SDL_Flip(screen);
-}
-
-
-int loadlevel(char *file, struct worldstruct *world) {
-  FILE *worldfile;
-  int x, y, z;
-  unsigned char buff[4];
-  worldfile = fopen(file, "rb");
-  if (worldfile == NULL) return(-1);
-  /* compute the width/height of the world */
-  fread(buff, 4, 1, worldfile);
-  world->width = buff[0];
-  world->width <<= 8;
-  world->width |= buff[1];
-  world->height = buff[0];
-  world->height <<= 8;
-  world->height |= buff[1];
-  /* read the world and populate the data table */
-  for (y = 0; y < world->width; y++) {
-    for (x = 0; x < world->width; x++) {
-      fread(buff, 4, 1, worldfile);
-      for (z = 0; z < 4; z++) {
-        world->tilemap[x][y][z] = buff[z];
+    if ((icon == NAV_ZOOMIN) || (icon == NAV_ZOOMOUT)) {
+      line.x = rect.x + 3;
+      line.y = rect.y + h / 2 - 1;
+      line.w = w - 6;
+      line.h = 2;
+      SDL_FillRect(screen, &line, black);
+      if (icon == NAV_ZOOMIN) {
+        line.x = rect.x + w / 2 - 1;
+        line.y = rect.y + 3;
+        line.w = 2;
+        line.h = h - 6;
+        SDL_FillRect(screen, &line, black);
       }
     }
   }
-  fclose(worldfile);
-  return(0);
 }
 
 
-int saveworld(char *file, struct worldstruct *world) {
-  FILE *worldfile;
-  int x, y, z;
-  unsigned char buff[4];
-  worldfile = fopen(file, "wb");
-  if (worldfile == NULL) return(-1);
-  /* compute the width/height of the world */
-  fprintf(worldfile, "%c", (world->width >> 8) & 0xFF);
-  fprintf(worldfile, "%c", world->width & 0xFF);
-  fprintf(worldfile, "%c", (world->height >> 8) & 0xFF);
-  fprintf(worldfile, "%c", world->height & 0xFF);
-  /* write the world into the data file */
-  for (y = 0; y < world->width; y++) {
-    for (x = 0; x < world->width; x++) {
-      fread(buff, 3, 1, worldfile);
-      for (z = 0; z < 4; z++) {
-        fprintf(worldfile, "%c", world->tilemap[x][y][z]);
+/* computes where the minimap is drawn on screen */
+static void minimapposition(struct editstate *ed, struct editsprites *sprites, struct worldstruct *world, int *sx, int *sy) {
+  *sx = mapareawidth(ed, sprites) - world->width * ed->minimap.scale - 8;
+  *sy = 8;
+}
+
+
+/* draws the minimap over the map area, with the part of the map that is on
+ * screen outlined */
+static void drawminimap(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, struct worldstruct *world) {
+  int sx, sy;
+  minimapposition(ed, sprites, world, &sx, &sy);
+  minimap_draw(&ed->minimap, world, screen, sx, sy);
+  minimap_frame(&ed->minimap, world, screen, sx, sy, ed->viewx, ed->viewy, mapareawidth(ed, sprites) / ed->cellw, screen->h / ed->cellh, white(screen));
+  adddirty(ed, screen, sx, sy, world->width * ed->minimap.scale, world->height * ed->minimap.scale);
+}
+
+
+/* restores whatever the cursor was drawn over */
+static void erasecursor(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites) {
+  SDL_Rect rect;
+  int x = ed->cursorx, y = ed->cursory;
+  if (x < 0) return;
+  ed->cursorx = -1;
+  if (ed->cursorscreenx == ed->controlcolumn) {
+      drawpalettecell(ed, screen, sprites, ed->cursorscreeny);
+    } else if (celltoscreen(ed, screen, sprites, x, y, &rect) == 0) {
+      drawmapcell(ed, screen, sprites, x, y);
+  }
+}
+
+
+/* draws the cursor under the mouse, if it moved to another cell (or if
+ * force is set) */
+static void drawcursor(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, int force) {
+  SDL_Rect rect, pos;
+  SDL_Surface **tiles;
+  int mx, my, sx, sy, x = 0, y = 0;
+  SDL_GetMouseState(&mx, &my);
+  sx = mx / sprites->tiles[0]->w;
+  sy = my / sprites->tiles[0]->h;
+  if (sx == ed->controlcolumn) {
+      /* the cursor is over the palette: remember it with a dummy map cell */
+      x = 0;
+      y = 0;
+      rect.x = sx * sprites->tiles[0]->w;
+      rect.y = sy * sprites->tiles[0]->h;
+      tiles = sprites->zoomed[0];
+    } else if ((screentocell(ed, screen, sprites, mx, my, &x, &y) != 0) || (celltoscreen(ed, screen, sprites, x, y, &rect) != 0)) {
+      erasecursor(ed, screen, sprites);
+      return; /* not over the map, nor over the palette */
+    } else {
+      sx = -1; /* over the map, where the screen cell depends on the zoom */
+      tiles = sprites->zoomed[ed->zoom];
+  }
+  if ((force == 0) && (ed->cursorx == x) && (ed->cursory == y) && (sx == ed->cursorscreenx) && ((sx < 0) || (sy == ed->cursorscreeny))) return;
+  erasecursor(ed, screen, sprites);
+  ed->cursorx = x;
+  ed->cursory = y;
+  ed->cursorscreenx = sx;
+  ed->cursorscreeny = sy;
+  adddirty(ed, screen, rect.x, rect.y, tiles[0]->w, tiles[0]->h);
+  pos = rect; /* SDL_BlitSurface() may alter the destination rect */
+  if ((sx != ed->controlcolumn) && (ed->tool < TOOL_SELECT)) SDL_BlitSurface(tiles[ed->selectedtile], NULL, screen, &pos);
+  pos = rect;
+  SDL_BlitSurface(tiles[17], NULL, screen, &pos);
+}
+
+
+/* fills the part of rect that is in the map area */
+static void fillmaparea(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, SDL_Rect rect, Uint32 color) {
+  int x1 = rect.x, y1 = rect.y, x2 = rect.x + rect.w, y2 = rect.y + rect.h;
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 > mapareawidth(ed, sprites)) x2 = mapareawidth(ed, sprites);
+  if (y2 > screen->h) y2 = screen->h;
+  if ((x1 >= x2) || (y1 >= y2)) return;
+  rect.x = x1;
+  rect.y = y1;
+  rect.w = x2 - x1;
+  rect.h = y2 - y1;
+  adddirty(ed, screen, rect.x, rect.y, rect.w, rect.h);
+  SDL_FillRect(screen, &rect, color);
+}
+
+
+/* draws what floats over the map: the outline of the selection, or the
+ * preview of the clipboard under the mouse when pasting, straight from the
+ * zoomed tiles. the previous overlay is erased first, by copying its cells
+ * back from the map cache. returns non-zero if anything has been drawn. */
+static int drawoverlay(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites) {
+  SDL_Rect rect, line;
+  struct stamprun *run;
+  int mx, my, x1 = 0, y1 = 0, x2 = -1, y2 = -1, r, i, t;
+  Uint32 black;
+  if ((ed->tool == TOOL_PASTE) && (ed->clipboard.w > 0)) {
+      SDL_GetMouseState(&mx, &my);
+      if (screentocell(ed, screen, sprites, mx, my, &x1, &y2) == 0) {
+        x2 = x1 + ed->clipboard.w - 1;
+        y1 = y2 - ed->clipboard.h + 1;
       }
-    }
+    } else if ((ed->tool == TOOL_SELECT) && (ed->selection != 0)) {
+      x1 = (ed->selx1 < ed->selx2) ? ed->selx1 : ed->selx2;
+      x2 = (ed->selx1 < ed->selx2) ? ed->selx2 : ed->selx1;
+      y1 = (ed->sely1 < ed->sely2) ? ed->sely1 : ed->sely2;
+      y2 = (ed->sely1 < ed->sely2) ? ed->sely2 : ed->sely1;
   }
-  fclose(worldfile);
-  return(0);
+  if ((ed->overlaydamaged == 0) && (x1 == ed->overlayx1) && (y1 == ed->overlayy1) && (x2 == ed->overlayx2) && (y2 == ed->overlayy2)) return(0);
+  ed->overlaydamaged = 0;
+  if (ed->overlayx2 >= 0) drawmaprect(ed, screen, sprites, ed->overlayx1, ed->overlayy1, ed->overlayx2, ed->overlayy2);
+  ed->overlayx1 = x1;
+  ed->overlayy1 = y1;
+  ed->overlayx2 = x2;
+  ed->overlayy2 = y2;
+  if (x2 < 0) return(1);
+  if (ed->tool == TOOL_PASTE) {
+      for (r = 0; r < ed->clipboard.runcount; r++) {
+        run = &(ed->clipboard.run[r]);
+        for (i = 0; i < run->len; i++) {
+          t = ed->clipboard.tiles[run->tiles + i];
+          if (t >= sprites->tilescount) continue;
+          if (celltoscreen(ed, screen, sprites, x1 + run->x + i, y1 + run->y, &rect) != 0) continue;
+          adddirty(ed, screen, rect.x, rect.y, rect.w, rect.h);
+          SDL_BlitSurface(sprites->zoomed[ed->zoom][t], NULL, screen, &rect);
+        }
+      }
+    } else {
+      /* the four sides of the selection, clipped to the map area */
+      black = SDL_MapRGB(screen->format, 0, 0, 0);
+      rect.x = (x1 - ed->viewx) * ed->cellw;
+      rect.y = screen->h - ((y2 - ed->viewy + 1) * ed->cellh);
+      rect.w = (x2 - x1 + 1) * ed->cellw;
+      rect.h = (y2 - y1 + 1) * ed->cellh;
+      line = rect;
+      line.h = 1;
+      fillmaparea(ed, screen, sprites, line, black);
+      line.y = rect.y + rect.h - 1;
+      fillmaparea(ed, screen, sprites, line, black);
+      line = rect;
+      line.w = 1;
+      fillmaparea(ed, screen, sprites, line, black);
+      line.x = rect.x + rect.w - 1;
+      fillmaparea(ed, screen, sprites, line, black);
+  }
+  return(1);
+}
+
+
+/* redraws the whole editor screen */
+static void drawedit(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites) {
+  SDL_Rect src, dst;
+  SDL_FillRect(screen, NULL, white(screen));
+  /* the visible part of the map, straight from the map cache */
+  src.x = ed->viewx * ed->cellw;
+  src.y = ed->mapcache->h - (ed->viewy * ed->cellh) - screen->h;
+  src.w = mapareawidth(ed, sprites);
+  src.h = screen->h;
+  dst.x = 0;
+  dst.y = 0;
+  if (src.y < 0) {
+    dst.y = 0 - src.y;
+    src.h += src.y;
+    src.y = 0;
+  }
+  if (src.x + src.w > ed->mapcache->w) src.w = ed->mapcache->w - src.x;
+  SDL_BlitSurface(ed->mapcache, &src, screen, &dst);
+  ed->cursorx = -1;
+  ed->overlayx2 = -1;
+  drawnavigation(ed, screen, sprites);
+  drawpalette(ed, screen, sprites);
+  drawcursor(ed, screen, sprites, 1);
+  ed->dirtycount = -1;
+}
+
+
+/* moves the camera so that the map cell (viewx,viewy) is at the bottom left
+ * corner of the map area, at the given zoom, then redraws the screen. the
+ * camera is kept within the map. */
+static void setview(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, struct worldstruct *world, int viewx, int viewy, int zoom) {
+  int cols, rows;
+  if (zoom < 0) zoom = 0;
+  if (zoom >= EDIT_ZOOMLEVELS) zoom = EDIT_ZOOMLEVELS - 1;
+  if (zoom != ed->zoom) {
+    /* zoom around the center of the map area */
+    viewx += (mapareawidth(ed, sprites) / ed->cellw) / 2;
+    viewy += (screen->h / ed->cellh) / 2;
+    ed->zoom = zoom;
+    ed->cellw = sprites->zoomed[zoom][0]->w;
+    ed->cellh = sprites->zoomed[zoom][0]->h;
+    viewx -= (mapareawidth(ed, sprites) / ed->cellw) / 2;
+    viewy -= (screen->h / ed->cellh) / 2;
+    buildmapcache(ed, screen, sprites, world);
+  }
+  cols = mapareawidth(ed, sprites) / ed->cellw;
+  rows = screen->h / ed->cellh;
+  if (viewx > WORLD_MAXW - cols) viewx = WORLD_MAXW - cols;
+  if (viewy > WORLD_MAXH - rows) viewy = WORLD_MAXH - rows;
+  if (viewx < 0) viewx = 0;
+  if (viewy < 0) viewy = 0;
+  ed->viewx = viewx;
+  ed->viewy = viewy;
+  drawedit(ed, screen, sprites);
+}
+
+
+/* redraws a cell modified by an undo or redo */
+static void undotouched(int x, int y, int z, void *userdata) {
+  struct editctx *ctx = userdata;
+  autosave_touch(ctx->ed->autosave, x, y);
+  minimap_update(&ctx->ed->minimap, ctx->world, x, y);
+  if ((ctx->ed->viewmode != z) && (ctx->ed->viewmode != 4)) return; /* not displayed */
+  rendercell(ctx->ed, ctx->sprites, ctx->world, x, y);
+  drawmapcell(ctx->ed, ctx->screen, ctx->sprites, x, y);
+}
+
+
+/* records a cell modified by a painting tool in the undo journal and in
+ * the map cache. the screen is refreshed once the tool is done, see
+ * applytool() and paintat(). */
+static void painttouched(int x, int y, int z, int oldtile, void *userdata) {
+  struct editctx *ctx = userdata;
+  undo_record(ctx->ed->undo, x, y, z, oldtile, ctx->world->tilemap[x][y][z]);
+  autosave_touch(ctx->ed->autosave, x, y);
+  minimap_update(&ctx->ed->minimap, ctx->world, x, y);
+  rendercell(ctx->ed, ctx->sprites, ctx->world, x, y);
+  if (x < ctx->minx) ctx->minx = x;
+  if (y < ctx->miny) ctx->miny = y;
+  if (x > ctx->maxx) ctx->maxx = x;
+  if (y > ctx->maxy) ctx->maxy = y;
+}
+
+
+/* forgets the bounding box of modified cells, before using a tool */
+static void clearbbox(struct editctx *ctx) {
+  ctx->minx = WORLD_MAXW;
+  ctx->miny = WORLD_MAXH;
+  ctx->maxx = -1;
+  ctx->maxy = -1;
+}
+
+
+/* paints with the pen up to the map cell under the (sx,sy) screen position,
+ * joining it to the previous cell painted during the stroke with a line so
+ * that no cell is skipped when the mouse moves fast, then updates the screen
+ * for these cells only */
+static void paintat(struct editctx *ctx, int sx, int sy) {
+  struct editstate *ed = ctx->ed;
+  int x, y;
+  if (ed->viewmode >= WORLD_LAYERS) return; /* all layers are displayed: don't know which one to edit */
+  if (screentocell(ed, ctx->screen, ctx->sprites, sx, sy, &x, &y) != 0) {
+    ed->penx = -1; /* left the map, start over when coming back */
+    return;
+  }
+  if (ed->penx < 0) {
+    ed->penx = x;
+    ed->peny = y;
+  }
+  clearbbox(ctx);
+  paint_line(ctx->world, ed->penx, ed->peny, x, y, ed->viewmode, ed->selectedtile, painttouched, ctx);
+  ed->penx = x;
+  ed->peny = y;
+  if (ctx->maxx >= 0) drawmaprect(ed, ctx->screen, ctx->sprites, ctx->minx, ctx->miny, ctx->maxx, ctx->maxy);
 }
 
-void createemptyworld(struct worldstruct *world, int w, int h) {
-  int x, y, z;
-  world->width = w;
-  world->height = h;
-  for (y = 0; y < world->height; y++) {
-    for (x = 0; x < world->width; x++) {
-      for (z = 0; z < 3; z++) world->tilemap[x][y][z] = 0;
+
+/* applies the fill, rectangle, line or paste tool of the editor from the map
+ * cell (x1,y1) to the map cell (x2,y2), as a single undo step, then
+ * refreshes the modified part of the screen in one go */
+static void applytool(struct editctx *ctx, int x1, int y1, int x2, int y2) {
+  struct editstate *ed = ctx->ed;
+  /* when all layers are displayed, don't know which one to edit - unless
+   * pasting, which writes all layers of the clipboard */
+  if ((ed->viewmode >= WORLD_LAYERS) && (ed->tool != TOOL_PASTE)) return;
+  clearbbox(ctx);
+  undo_begin(ed->undo);
+  switch (ed->tool) {
+    case TOOL_FILL:
+      paint_floodfill(ctx->world, x2, y2, ed->viewmode, ed->selectedtile, painttouched, ctx);
+      break;
+    case TOOL_RECT:
+      paint_rect(ctx->world, x1, y1, x2, y2, ed->viewmode, ed->selectedtile, painttouched, ctx);
+      break;
+    case TOOL_LINE:
+      paint_line(ctx->world, x1, y1, x2, y2, ed->viewmode, ed->selectedtile, painttouched, ctx);
+      break;
+    case TOOL_PASTE:
+      stamp_paste(&ed->clipboard, ctx->world, x2, y2 - ed->clipboard.h + 1, painttouched, ctx);
+      break;
+    default:
+      break;
+  }
+  undo_end(ed->undo);
+  if (ctx->maxx >= 0) drawmaprect(ed, ctx->screen, ctx->sprites, ctx->minx, ctx->miny, ctx->maxx, ctx->maxy);
+}
+
+
+/* scrolls the view by (dx,dy) cells, or by (dx,dy) screens if page is set */
+static void scrollview(struct editstate *ed, SDL_Surface *screen, struct editsprites *sprites, struct worldstruct *world, int dx, int dy, int page) {
+  if (page != 0) {
+    dx *= mapareawidth(ed, sprites) / ed->cellw;
+    dy *= screen->h / ed->cellh;
+  }
+  setview(ed, screen, sprites, world, ed->viewx + dx, ed->viewy + dy, ed->zoom);
+}
+
+
+/* plays the world being edited, straight from memory, the player being
+ * dropped at the (x,y) cell. the game goes on until ESC is pressed or the
+ * player reaches an exit. returns non-zero if the editor has been asked to
+ * quit meanwhile. */
+static int playtest(SDL_Surface *screen, struct spritesstruct *sprites, struct worldstruct *world, int x, int y) {
+  struct character player;
+  struct virtualkeyboard keybstate;
+  SDL_Event event;
+  Uint32 lastframe, now;
+  int elapsed_time, quit = 0, done = 0;
+
+  /* the editor doesn't maintain the collision and objects grids */
+  buildcollisiongrid(world, 0, 0, world->width, world->height);
+  buildobjectgrid(world);
+
+  memset(&keybstate, 0, sizeof(keybstate));
+  memset(&player, 0, sizeof(player));
+  player.collisionoffset_up = 12;
+  player.collisionoffset_down = 4;
+  player.collisionoffset_left = 8;
+  player.collisionoffset_right = 8;
+  player.spritedir = 1;
+  player.sprite = sprites->player[1][0];
+  player.xpos = x * sprites->tiles[0]->w;
+  player.ypos = y * sprites->tiles[0]->h;
+
+  lastframe = SDL_GetTicks();
+  while (done == 0) {
+    /* same pace as the game: not more than a frame every 20ms */
+    now = SDL_GetTicks();
+    elapsed_time = now - lastframe;
+    if (elapsed_time < 20) {
+      SDL_Delay(20 - elapsed_time);
+      continue;
     }
+    lastframe = now;
+
+    while (SDL_PollEvent(&event) != 0) {
+      if (event.type == SDL_QUIT) {
+          quit = 1;
+          done = 1;
+        } else if ((event.type == SDL_KEYDOWN) && (event.key.keysym.sym == SDLK_ESCAPE)) {
+          done = 1;
+        } else {
+          updatekeyboard(&keybstate, &event);
+      }
+    }
+
+    run_engine(world, &player, elapsed_time, sprites, &keybstate);
+    if ((touchesobject(world, &player, sprites, OBJ_EXIT) != 0) || (player.xpos + player.sprite->w >= world->width * sprites->tiles[0]->w)) done = 1;
+
+    drawscreen(screen, sprites, &player, world, &keybstate, elapsed_time);
+    SDL_Flip(screen);
   }
+  return(quit);
 }
 
 
 int main(int argc, char **argv) {
   struct worldstruct world;  /* the world is a set of 64x64 tiles */
-  struct spritesstruct sprites;
+  struct editsprites sprites;
+  struct spritesstruct gamesprites; /* what the engine needs to play the world */
+  struct assetjob assetjob[3];
   char *worldfilename;
   SDL_Surface *screen;
   SDL_Event event;
-  int exitflag = 0, refreshscreen = 1, viewmode = 4;
-  int controlcolumn = 42, selectedtile = 0, selectedtile_offset = 0, painting = 0;
+  struct editstate ed;
+  struct editctx ctx;
+  int exitflag = 0, timeout, leaks, i, z;
+  char stampfile[32];
+
+  if ((argc == 3) && (strcmp(argv[1], "--verify") == 0)) {
+    int badchunks = verifylevel(argv[2]);
+    if (badchunks < 0) {
+        printf("%s: not a chunked level, or damaged header/directory\n", argv[2]);
+      } else if (badchunks > 0) {
+        printf("%s: %d corrupted chunk(s)\n", argv[2], badchunks);
+      } else {
+        printf("%s: OK\n", argv[2]);
+    }
+    return((badchunks == 0) ? 0 : 1);
+  }
 
   if (argc != 2) {
-    printf("Usage: edit file.dat\n");
+    printf("Usage: edit file.dat\n"
+           "       edit --verify file.dat\n");
     return(0);
   }
 
   worldfilename = argv[1];
 
-  if (loadlevel(worldfilename, &world) != 0) {
-    printf("The world file do not exist yet. Loading a default world.\n");
-    createemptyworld(&world, 64, 64);
+  if (autosave_recover(worldfilename, &world) == 0) {
+      printf("Recovered unsaved changes from %s.autosave\n", worldfilename);
+    } else if (loadlevel(worldfilename, &world) != 0) {
+      printf("The world file do not exist yet. Loading a default world.\n");
+      createemptyworld(&world, 64, 64);
   }
 
   /* init the SDL library */
   SDL_Init(SDL_INIT_VIDEO);
 
   /* init the video mode on screen */
-  screen = SDL_SetVideoMode(690, 480, 32, SDL_SWSURFACE | SDL_DOUBLEBUF);
+  screen = SDL_SetVideoMode(690, 480, 32, SDL_SWSURFACE);
+
+  /* load the tiles, and the possum the engine plays with, in parallel */
+  memset(&gamesprites, 0, sizeof(gamesprites));
+  openassetpack(ASSETS_PACK);
+  setassetjob(&assetjob[0], "tiles", sprites.tiles, 64);
+  setassetjob(&assetjob[1], "possum_left", gamesprites.player[0], 16);
+  setassetjob(&assetjob[2], "possum_right", gamesprites.player[1], 16);
+  if (loadassets(assetjob, 3, 0) != 0) {
+    SDL_Quit();
+    puts("failed to load the sprites");
+    return(1);
+  }
+  sprites.tilescount = assetjob[0].result;
+  /* shrunk copies of the tiles, so zooming out costs no more than drawing
+   * at 1:1, all of them converted to the format of the screen once and
+   * for all */
+  for (i = 0; i < sprites.tilescount; i++) {
+    sprites.zoomed[0][i] = displaytile(sprites.tiles[i], 0);
+    for (z = 1; z < EDIT_ZOOMLEVELS; z++) sprites.zoomed[z][i] = displaytile(shrinktile(sprites.tiles[i], z), 1);
+  }
+  /* the engine plays with the same tiles */
+  gamesprites.tilescount = sprites.tilescount;
+  for (i = 0; i < sprites.tilescount; i++) gamesprites.tiles[i] = sprites.tiles[i];
+  gamesprites.playercount = (assetjob[1].result < assetjob[2].result) ? assetjob[1].result : assetjob[2].result;
+  packsprites(&gamesprites);
 
-  /* load tiles */
-  sprites.tilescount = 64;
-  loadSpriteSheet(sprites.tiles, 16, 16, sprites.tilescount, tiles_png, tiles_png_len);
+  world.bg = NULL; /* getasset("bg")->frame[0]; */
+  world.backcache = NULL;
 
-  world.bg = NULL; /* loadGraphic(bg_png, bg_png_len); */
+  /* init the editor state and draw the whole screen once */
+  memset(&ed, 0, sizeof(ed));
+  ed.viewmode = 4;
+  ed.controlcolumn = 42;
+  ed.cursorx = -1;
+  ed.overlayx2 = -1;
+  ed.cellw = sprites.tiles[0]->w;
+  ed.cellh = sprites.tiles[0]->h;
+  ed.undo = malloc(sizeof(struct undojournal));
+  if (ed.undo == NULL) {
+    SDL_Quit();
+    puts("out of memory");
+    return(1);
+  }
+  undo_init(ed.undo);
+  if (minimap_init(&ed.minimap, sprites.tiles, sprites.tilescount, screen->format, 2) == 0) {
+    minimap_build(&ed.minimap, &world);
+    ed.showminimap = 1;
+  }
+  ed.autosave = autosave_start(worldfilename, &world);
+  if (ed.autosave == NULL) printf("Failed to start the autosave, changes will only be saved on exit!\n");
+  ctx.ed = &ed;
+  ctx.screen = screen;
+  ctx.sprites = &sprites;
+  ctx.world = &world;
+  buildmapcache(&ed, screen, &sprites, &world);
+  drawedit(&ed, screen, &sprites);
 
   while (exitflag == 0) {
-    if (painting != 0) {
-      int tilex, tiley;
-      SDL_GetMouseState(&tilex, &tiley);
-      tilex /= sprites.tiles[0]->w;
-      tiley /= sprites.tiles[0]->h;
-      if (viewmode < 4) world.tilemap[tilex][(screen->h / sprites.tiles[0]->h) - (tiley + 1)][viewmode] = selectedtile;
-    }
-    if (refreshscreen != 0) drawscreen(screen, &sprites, &world, controlcolumn, selectedtile, selectedtile_offset, viewmode);
-    refreshscreen = 0;
+    /* the cursor goes last, on top of whatever has been redrawn, only
+     * covered by the minimap. the overlay is redrawn if it may have been
+     * drawn over, erasing the cursor in the process sometimes */
+    if (ed.dirtycount != 0) ed.overlaydamaged = 1;
+    drawcursor(&ed, screen, &sprites, 0);
+    if (drawoverlay(&ed, screen, &sprites) != 0) drawcursor(&ed, screen, &sprites, 0);
+    if ((ed.showminimap != 0) && (ed.dirtycount != 0)) drawminimap(&ed, screen, &sprites, &world);
+    flushdirty(&ed, screen);
 
-    while (SDL_PollEvent(&event) != 0) {
-      refreshscreen = 1;
+    /* sleep until something happens or the next autosave is due, then
+     * handle all pending events before refreshing the screen */
+    timeout = autosave_due(ed.autosave);
+    if (timeout == 0) {
+      autosave_snapshot(ed.autosave, &world);
+      timeout = -1;
+    }
+    if (waitevent(&event, timeout) == 0) continue;
+    do {
       if (event.type == SDL_QUIT) {
           exitflag = 1;
         } else if (event.type == SDL_KEYDOWN) {
+          int newviewmode = ed.viewmode;
           switch (event.key.keysym.sym) {
             case SDLK_F1:
-              viewmode = 0;
+              newviewmode = 0;
               break;
             case SDLK_F2:
-              viewmode = 1;
+              newviewmode = 1;
               break;
             case SDLK_F3:
-              viewmode = 2;
+              newviewmode = 2;
               break;
             case SDLK_F4:
-              viewmode = 3;
+              newviewmode = 3;
               break;
             case SDLK_F5:
-              viewmode = 4;
+              newviewmode = 4;
+              break;
+            case SDLK_UP:  /* arrows scroll the view by one cell, or by one screen with SHIFT */
+              scrollview(&ed, screen, &sprites, &world, 0, 1, event.key.keysym.mod & KMOD_SHIFT);
+              break;
+            case SDLK_DOWN:
+              scrollview(&ed, screen, &sprites, &world, 0, -1, event.key.keysym.mod & KMOD_SHIFT);
+              break;
+            case SDLK_LEFT:
+              scrollview(&ed, screen, &sprites, &world, -1, 0, event.key.keysym.mod & KMOD_SHIFT);
+              break;
+            case SDLK_RIGHT:
+              scrollview(&ed, screen, &sprites, &world, 1, 0, event.key.keysym.mod & KMOD_SHIFT);
+              break;
+            case SDLK_PLUS:
+            case SDLK_EQUALS:
+            case SDLK_KP_PLUS:
+              setview(&ed, screen, &sprites, &world, ed.viewx, ed.viewy, ed.zoom - 1);
+              break;
+            case SDLK_MINUS:
+            case SDLK_KP_MINUS:
+              setview(&ed, screen, &sprites, &world, ed.viewx, ed.viewy, ed.zoom + 1);
+              break;
+            case SDLK_g:  /* G plays the world, from where the mouse is */
+              {
+                int mx, my, tilex, tiley, tw, th;
+                if (ed.painting != 0) break; /* not in the middle of a stroke */
+                SDL_GetMouseState(&mx, &my);
+                if ((screentocell(&ed, screen, &sprites, mx, my, &tilex, &tiley) != 0) || (tilex >= world.width) || (tiley >= world.height)) {
+                  puts("Point the mouse where the possum should be dropped");
+                  break;
+                }
+                /* the whole possum must be in the world, the engine doesn't
+                 * look for solid tiles outside of it */
+                tw = gamesprites.tiles[0]->w;
+                th = gamesprites.tiles[0]->h;
+                if (tilex > world.width - (gamesprites.player[1][0]->w + tw - 1) / tw) tilex = world.width - (gamesprites.player[1][0]->w + tw - 1) / tw;
+                if (tiley > world.height - (gamesprites.player[1][0]->h + th - 1) / th) tiley = world.height - (gamesprites.player[1][0]->h + th - 1) / th;
+                if ((tilex < 0) || (tiley < 0)) {
+                  puts("The world is too small for the possum");
+                  break;
+                }
+                if (playtest(screen, &gamesprites, &world, tilex, tiley) != 0) exitflag = 1;
+                drawedit(&ed, screen, &sprites);
+              }
+              break;
+            case SDLK_m:  /* M shows or hides the minimap */
+              ed.showminimap = !ed.showminimap;
+              drawedit(&ed, screen, &sprites);
+              break;
+            case SDLK_p:  /* P, F, R and L select the pen, fill, rectangle and line tools */
+              if ((event.key.keysym.mod & KMOD_CTRL) == 0) ed.tool = TOOL_PEN;
+              break;
+            case SDLK_f:
+              if ((event.key.keysym.mod & KMOD_CTRL) == 0) ed.tool = TOOL_FILL;
+              break;
+            case SDLK_r:
+              if ((event.key.keysym.mod & KMOD_CTRL) == 0) ed.tool = TOOL_RECT;
+              break;
+            case SDLK_l:
+              if ((event.key.keysym.mod & KMOD_CTRL) == 0) ed.tool = TOOL_LINE;
+              break;
+            case SDLK_c:  /* CTRL+C copies the selection, on the displayed layers */
+              if ((event.key.keysym.mod & KMOD_CTRL) && (ed.selection != 0)) {
+                stamp_copy(&ed.clipboard, &world, ed.selx1, ed.sely1, ed.selx2, ed.sely2, (ed.viewmode < WORLD_LAYERS) ? (1 << ed.viewmode) : ((1 << WORLD_LAYERS) - 1));
+              }
+              break;
+            case SDLK_v:  /* CTRL+V pastes it, where clicked */
+              if ((event.key.keysym.mod & KMOD_CTRL) && (ed.clipboard.w > 0)) ed.tool = TOOL_PASTE;
+              break;
+            case SDLK_ESCAPE:  /* back to the pen */
+              ed.tool = TOOL_PEN;
+              ed.selection = 0;
+              break;
+            case SDLK_1:  /* 1..9 load a stamp into the clipboard, CTRL+1..9 save the clipboard as a stamp */
+            case SDLK_2:
+            case SDLK_3:
+            case SDLK_4:
+            case SDLK_5:
+            case SDLK_6:
+            case SDLK_7:
+            case SDLK_8:
+            case SDLK_9:
+              sprintf(stampfile, "stamp%d.stp", event.key.keysym.sym - SDLK_0);
+              if ((event.key.keysym.mod & KMOD_CTRL) == 0) {
+                  if (stamp_load(&ed.clipboard, stampfile) == 0) {
+                      ed.tool = TOOL_PASTE;
+                    } else {
+                      printf("Failed to load the stamp %s\n", stampfile);
+                  }
+                } else if (ed.clipboard.w > 0) {
+                  if (stamp_save(&ed.clipboard, stampfile) == 0) {
+                      printf("Clipboard saved as %s\n", stampfile);
+                    } else {
+                      printf("Failed to save the stamp %s!\n", stampfile);
+                  }
+              }
+              break;
+            case SDLK_z:  /* CTRL+Z undoes the last stroke */
+              if (event.key.keysym.mod & KMOD_CTRL) undo_undo(ed.undo, &world, undotouched, &ctx);
+              break;
+            case SDLK_y:  /* CTRL+Y redoes it */
+              if (event.key.keysym.mod & KMOD_CTRL) undo_redo(ed.undo, &world, undotouched, &ctx);
+              break;
+            case SDLK_s:  /* S selects the selection tool, CTRL+S saves the world right away */
+              if ((event.key.keysym.mod & KMOD_CTRL) == 0) {
+                  ed.tool = TOOL_SELECT;
+                } else {
+                  if (savelevel(worldfilename, &world) != 0) {
+                      printf("Failed to save the world to %s!\n", worldfilename);
+                    } else {
+                      printf("World saved to %s\n", worldfilename);
+                      autosave_saved(ed.autosave);
+                  }
+              }
               break;
             default:
               break;
           }
+          if (newviewmode != ed.viewmode) { /* the map cache is only valid for one view mode */
+            ed.viewmode = newviewmode;
+            buildmapcache(&ed, screen, &sprites, &world);
+            drawedit(&ed, screen, &sprites);
+          }
+        } else if ((event.type == SDL_MOUSEBUTTONDOWN) && ((event.button.button == SDL_BUTTON_WHEELUP) || (event.button.button == SDL_BUTTON_WHEELDOWN))) {
+          /* the wheel scrolls the view vertically, horizontally with SHIFT, or zooms with CTRL */
+          int step = (event.button.button == SDL_BUTTON_WHEELUP) ? 1 : -1;
+          if (SDL_GetModState() & KMOD_CTRL) {
+              setview(&ed, screen, &sprites, &world, ed.viewx, ed.viewy, ed.zoom - step);
+            } else if (SDL_GetModState() & KMOD_SHIFT) {
+              scrollview(&ed, screen, &sprites, &world, -2 * step, 0, 0);
+            } else {
+              scrollview(&ed, screen, &sprites, &world, 0, 2 * step, 0);
+          }
         } else if (event.type == SDL_MOUSEBUTTONDOWN) {
-          int tilex, tiley;
+          int tilex, tiley, mmx, mmy;
           tilex = event.button.x / sprites.tiles[0]->w;
           tiley = event.button.y / sprites.tiles[0]->h;
-          printf("MOUSE BUTTON at tile [%d,%d] (control is %d)\n", tilex, tiley, controlcolumn);
-          if (tilex == controlcolumn) { /* select a tile */
+          printf("MOUSE BUTTON at tile [%d,%d] (control is %d)\n", tilex, tiley, ed.controlcolumn);
+          minimapposition(&ed, &sprites, &world, &mmx, &mmy);
+          if ((ed.showminimap != 0) && (minimap_cellat(&ed.minimap, &world, mmx, mmy, event.button.x, event.button.y, &mmx, &mmy) == 0)) {
+              /* center the view on the cell clicked on the minimap */
+              setview(&ed, screen, &sprites, &world, mmx - (mapareawidth(&ed, &sprites) / ed.cellw) / 2, mmy - (screen->h / ed.cellh) / 2, ed.zoom);
+            } else if (tilex == ed.controlcolumn - 1) { /* navigation icons */
+              switch (tiley) {
+                case NAV_UP:
+                  scrollview(&ed, screen, &sprites, &world, 0, 1, 1);
+                  break;
+                case NAV_DOWN:
+                  scrollview(&ed, screen, &sprites, &world, 0, -1, 1);
+                  break;
+                case NAV_LEFT:
+                  scrollview(&ed, screen, &sprites, &world, -1, 0, 1);
+                  break;
+                case NAV_RIGHT:
+                  scrollview(&ed, screen, &sprites, &world, 1, 0, 1);
+                  break;
+                case NAV_ZOOMIN:
+                  setview(&ed, screen, &sprites, &world, ed.viewx, ed.viewy, ed.zoom - 1);
+                  break;
+                case NAV_ZOOMOUT:
+                  setview(&ed, screen, &sprites, &world, ed.viewx, ed.viewy, ed.zoom + 1);
+                  break;
+                default:
+                  break;
+              }
+            } else if (tilex == ed.controlcolumn) { /* select a tile */
               if (tiley == 0) {
-                  if (selectedtile_offset > 0) selectedtile_offset -= 1;
+                  if (ed.selectedtile_offset > 0) ed.selectedtile_offset -= 1;
+                  drawpalette(&ed, screen, &sprites);
                 } else if (tiley == (screen->h - 1) / sprites.tiles[0]->h) {
-                  if (selectedtile_offset < 30) selectedtile_offset += 1;
+                  if (ed.selectedtile_offset < 30) ed.selectedtile_offset += 1;
+                  drawpalette(&ed, screen, &sprites);
                 } else {
-                  selectedtile = tiley - 1 + selectedtile_offset;
+                  ed.selectedtile = tiley - 1 + ed.selectedtile_offset;
               }
-            } else { /* put a tile in the world */
-              painting = 1;
+              erasecursor(&ed, screen, &sprites); /* the palette or the selected tile changed, the cursor needs to be redrawn */
+            } else if (screentocell(&ed, screen, &sprites, event.button.x, event.button.y, &tilex, &tiley) != 0) {
+              /* outside of the map */
+            } else if ((ed.tool == TOOL_FILL) || (ed.tool == TOOL_PASTE)) {
+              applytool(&ctx, tilex, tiley, tilex, tiley);
+            } else if (ed.tool == TOOL_SELECT) { /* the selection follows the mouse until the button is released */
+              ed.selection = 1;
+              ed.selx1 = tilex;
+              ed.sely1 = tiley;
+              ed.selx2 = tilex;
+              ed.sely2 = tiley;
+              ed.painting = 3;
+            } else if ((ed.tool == TOOL_RECT) || (ed.tool == TOOL_LINE)) { /* applied when the button is released */
+              ed.toolx = tilex;
+              ed.tooly = tiley;
+              ed.painting = 2;
+            } else { /* put a tile in the world - everything painted until the button is released is one undo step */
+              ed.painting = 1;
+              ed.penx = -1;
+              undo_begin(ed.undo);
+              paintat(&ctx, event.button.x, event.button.y);
+          }
+        } else if ((event.type == SDL_MOUSEBUTTONUP) && (event.button.button != SDL_BUTTON_WHEELUP) && (event.button.button != SDL_BUTTON_WHEELDOWN)) {
+          int tilex, tiley;
+          if (ed.painting == 1) undo_end(ed.undo);
+          if ((ed.painting == 2) && (screentocell(&ed, screen, &sprites, event.button.x, event.button.y, &tilex, &tiley) == 0)) {
+            applytool(&ctx, ed.toolx, ed.tooly, tilex, tiley);
+          }
+          ed.painting = 0;
+        } else if ((event.type == SDL_MOUSEMOTION) && (ed.painting == 1)) {
+          paintat(&ctx, event.motion.x, event.motion.y);
+        } else if ((event.type == SDL_MOUSEMOTION) && (ed.painting == 3)) {
+          int tilex, tiley;
+          if (screentocell(&ed, screen, &sprites, event.motion.x, event.motion.y, &tilex, &tiley) == 0) {
+            ed.selx2 = tilex;
+            ed.sely2 = tiley;
           }
-        } else if (event.type == SDL_MOUSEBUTTONUP) {
-          painting = 0;
       }
-    }
-    if ((refreshscreen == 0) && (painting == 0)) usleep(100000);
+    } while ((exitflag == 0) && (SDL_PollEvent(&event) != 0));
   }
 
   /* clean up SDL */
+  registry_freesurface(ed.mapcache);
+  minimap_free(&ed.minimap);
+  stamp_free(&ed.clipboard);
+  for (i = 0; i < sprites.tilescount; i++) {
+    if (sprites.zoomed[0][i] != sprites.tiles[i]) registry_freesurface(sprites.zoomed[0][i]);
+    for (z = 1; z < EDIT_ZOOMLEVELS; z++) registry_freesurface(sprites.zoomed[z][i]);
+  }
+  freesprites(&gamesprites);
+  /* the tiles and the possum go back to the asset manager, to be freed */
+  for (i = 0; i < 3; i++) releaseasset(assetjob[i].asset);
+  freeassets();
+  free(ed.undo);
   SDL_Quit();
+  leaks = registry_leaks(stdout);
+
+  if (savelevel(worldfilename, &world) != 0) {
+      printf("Failed to save the world to %s!\n", worldfilename);
+      autosave_snapshot(ed.autosave, &world); /* keep the changes in the autosave at least */
+    } else {
+      autosave_saved(ed.autosave);
+  }
+  autosave_stop(ed.autosave);
 
-  saveworld(worldfilename, &world);
+  if (leaks > 0) return(1);
 
   return(0);
 }
@@ -0,0 +1,341 @@
+/* game engine of Mike O'Possum */
+
+#include <SDL/SDL.h>
+
+#include "level.h"
+#include "engine.h"
+
+
+static void draw_tiles(struct spritesstruct *sprites, struct worldstruct *world, SDL_Surface *screen, int displayoffset_x, int z1, int z2) {
+  SDL_Rect rect, tilerect;
+  struct atlasregion *region;
+  int x, y, z, clip;
+  rect.w = sprites->tiles[0]->w;
+  rect.h = sprites->tiles[0]->h;
+  for (y = 0; y < 64; y++) {
+    rect.y = screen->h - ((y + 1) * sprites->tiles[0]->h);
+    for (x = (displayoffset_x / sprites->tiles[0]->w); x <= ((displayoffset_x + screen->w) / sprites->tiles[0]->w); x++) {
+      rect.x = (x * sprites->tiles[0]->w) - displayoffset_x;
+      if (rect.x >= 0) {
+          clip = 0;
+        } else {
+          clip = 0 - rect.x;
+          rect.x = 0;
+      }
+      for (z = z1; z <= z2; z++) {
+        if (world->tilemap[x][y][z] <= 0) continue;
+        /* the tile is only a part of its page: the part left of the
+         * screen is cut off here, as SDL wouldn't know where the tile ends */
+        region = &sprites->tileregion[world->tilemap[x][y][z]];
+        tilerect.x = region->rect.x + clip;
+        tilerect.y = region->rect.y;
+        tilerect.w = region->rect.w - clip;
+        tilerect.h = region->rect.h;
+        SDL_BlitSurface(region->surface, &tilerect, screen, &rect);
+      }
+    }
+  }
+}
+
+
+void packsprites(struct spritesstruct *sprites) {
+  SDL_Surface *item[64 + 2 * 16];
+  struct atlasregion region[64 + 2 * 16];
+  int i, d, n = 0;
+  for (i = 0; i < sprites->tilescount; i++) item[n++] = sprites->tiles[i];
+  for (d = 0; d < 2; d++) {
+    for (i = 0; i < sprites->playercount; i++) item[n++] = sprites->player[d][i];
+  }
+  atlas_free(&sprites->atlas);
+  atlas_pack(&sprites->atlas, item, n, region);
+  atlas_displayformat(&sprites->atlas, region, n);
+  n = 0;
+  for (i = 0; i < sprites->tilescount; i++) sprites->tileregion[i] = region[n++];
+  for (d = 0; d < 2; d++) {
+    for (i = 0; i < sprites->playercount; i++) sprites->playerregion[d][i] = region[n++];
+  }
+}
+
+
+void freesprites(struct spritesstruct *sprites) {
+  atlas_free(&sprites->atlas);
+}
+
+
+void drawscreen(SDL_Surface *screen, struct spritesstruct *sprites, struct character *player, struct worldstruct *world, struct virtualkeyboard *keybstate, int elapsed_time) {
+  SDL_Rect rect;
+  int displayoffset_x;
+
+  /* the atlas was converted for another video mode: convert it again, or
+   * every blit from it would convert pixels */
+  if ((sprites->atlas.pagecount > 0) && (atlas_isdisplayformat(&sprites->atlas) == 0)) packsprites(sprites);
+
+  displayoffset_x = player->xpos + (player->sprite->w / 2) - (screen->w / 2);
+  if (displayoffset_x < 0) displayoffset_x = 0;
+  if (displayoffset_x >= (world->width * sprites->tiles[0]->w) - screen->w) displayoffset_x = (world->width * sprites->tiles[0]->w) - (screen->w + 1);
+  if (screen->w >= (world->width * sprites->tiles[0]->w)) displayoffset_x = 0;
+
+  SDL_FillRect(screen, NULL, 0);  /* fill the screen with black */
+  if (world->bg != NULL) SDL_BlitSurface(world->bg, NULL, screen, NULL); /* apply the background image, if any */
+
+  /* draw all the background tiles, using the pre-rendered cache if the world has one */
+  if ((world->backcache != NULL) && (world->bg == NULL)) {
+      SDL_Rect cacherect;
+      cacherect.x = displayoffset_x;
+      cacherect.y = world->backcache->h - screen->h;
+      cacherect.w = screen->w;
+      cacherect.h = screen->h;
+      rect.x = 0;
+      rect.y = 0;
+      if (cacherect.y < 0) {
+        rect.y = 0 - cacherect.y;
+        cacherect.y = 0;
+      }
+      SDL_BlitSurface(world->backcache, &cacherect, screen, &rect);
+    } else {
+      draw_tiles(sprites, world, screen, displayoffset_x, 0, COLLISION_LAYER);
+  }
+
+  /* compute the right sprite for current player's state */
+  player->spritestate_duration += elapsed_time;
+  if (keybstate->right != 0) { /* going right */
+      player->spritedir = 1;
+    } else if (keybstate->left != 0) { /* going left */
+      player->spritedir = 0;
+  }
+  if (player->neighbors_below == 0) { /* if flying... */
+      player->spritestate = 8;
+      player->spritestate_duration = 0;
+    } else {
+      if ((player->velocityx == 0) && (player->velocityy == 0)) { /* player is standing still */
+          if (player->spritestate > 3) player->spritestate_duration = 300; /* force a sprite change */
+          if (player->spritestate_duration >= 200) {
+            player->spritestate_duration -= 200;
+            player->spritestate += 1;
+            if (player->spritestate > 3) player->spritestate = 0;
+          }
+        } else {  /* player is in some kind of motion */
+          if ((player->spritestate < 4) || (player->spritestate > 7)) player->spritestate_duration = 240; /* force a sprite change */
+          if (player->spritestate_duration >= 160) {
+            player->spritestate_duration -= 160;
+            player->spritestate += 1;
+            if (player->spritestate > 7) player->spritestate = 4;
+          }
+      }
+  }
+  player->sprite = sprites->player[player->spritedir][player->spritestate];
+  /* put the player on screen */
+  rect.x = player->xpos - displayoffset_x;
+  rect.y = screen->h - (player->ypos + player->sprite->h);
+  rect.h = 0;
+  rect.w = 0;
+  SDL_BlitSurface(sprites->playerregion[player->spritedir][player->spritestate].surface, &sprites->playerregion[player->spritedir][player->spritestate].rect, screen, &rect);
+
+  /* draw the foreground tiles */
+  draw_tiles(sprites, world, screen, displayoffset_x, COLLISION_LAYER + 1, WORLD_LAYERS - 1);
+}
+
+
+void compute_neighbors(struct worldstruct *world, struct character *player, struct spritesstruct *sprites) {
+  int x, y;
+  /* check neighbors below us */
+  player->neighbors_below = 0; /* by default, we assume there is nobody below */
+  player->neighbors_below_left = 0; /* by default, we assume there is nobody below */
+  player->neighbors_below_right = 0; /* by default, we assume there is nobody below */
+  if (player->ypos == 0) {
+    player->neighbors_below_left = 1;
+    player->neighbors_below_right = 1;
+    player->neighbors_below = 1;
+  } else {
+    for (x = player->collisionoffset_left ; x < (player->sprite->w - player->collisionoffset_right) ; x++) {
+      if (world->solid[((player->xpos + x) / sprites->tiles[0]->w)][((player->ypos + player->collisionoffset_down - 1) / sprites->tiles[0]->h)] != 0) player->neighbors_below = 1;
+    }
+  }
+  
+  /* check neighbors above us */
+  player->neighbors_above = 0; /* by default, we assume there is nobody above */
+  player->neighbors_above_left = 0; /* by default, we assume there is nobody above */
+  player->neighbors_above_right = 0; /* by default, we assume there is nobody above */
+  for (x = player->collisionoffset_left ; x < (player->sprite->w - player->collisionoffset_right) ; x++) {
+    if (world->solid[((player->xpos + x) / sprites->tiles[0]->w)][((player->ypos + player->sprite->h + 1 - player->collisionoffset_up) / sprites->tiles[0]->h)] != 0) player->neighbors_above = 1;
+  }
+
+  /* check neighbors at left */
+  player->neighbors_left = 0; /* by default, we assume there is nobody at the left */
+  for (y = player->collisionoffset_down ; y < (player->sprite->h - player->collisionoffset_up) ; y++) {
+    if (world->solid[((player->xpos + player->collisionoffset_left - 1) / sprites->tiles[0]->w)][((player->ypos + y) / sprites->tiles[0]->h)] != 0) player->neighbors_left = 1;
+  }
+
+  /* check neighbors at right */
+  player->neighbors_right = 0; /* by default, we assume there is nobody at the right */
+  for (y = player->collisionoffset_down ; y < (player->sprite->h - player->collisionoffset_up) ; y++) {
+    if (world->solid[((player->xpos + player->sprite->w + 1 - player->collisionoffset_right) / sprites->tiles[0]->w)][((player->ypos + y) / sprites->tiles[0]->h)] != 0) player->neighbors_right = 1;
+  }
+
+}
+
+
+/* computes all the physics in the world */
+void run_engine(struct worldstruct *world, struct character *player, int elapsed_time, struct spritesstruct *sprites, struct virtualkeyboard *keybstate) {
+  #define gravityforce          1800    /* I gain this much falling momentum per ms when in the air */
+  #define frictionforce_ground  400     /* I loose this much horizontal momentum per ms when on the ground */
+  #define frictionforce_air     150     /* I loose this much horizontal momentum per ms when in the air */
+  #define maxvvelocity          600000  /* I cannot go up faster than that */
+  #define minvvelocity         -600000  /* I cannot fall faster than that */
+  #define maxhvelocity          300000  /* I cannot be propulsed right faster than that */
+  #define minhvelocity         -300000  /* I cannot be propulsed left faster than that */
+  #define jumptimelimit         100     /* I can hold the jump key this many ms at most to control my jump force */
+  #define jumpimpulse           14000   /* I gain this much momentum per ms when jump key is pressed */
+  #define collisionvelocityloss 2000    /* I loose this much momentum per ms when hitting an obstacle */
+  int airborne, frictionforce;  /* airborne flag. will be set if the player is flying */
+
+  /* set the airborne flag if we are flying, and update the airborne time accordingly */
+  compute_neighbors(world, player, sprites);
+  if (player->neighbors_below == 0) airborne = 1; else airborne = 0;
+  if (airborne != 0) {
+      player->airborne_timer += elapsed_time;
+      frictionforce = frictionforce_air;
+    } else {
+      player->airborne_timer = 0;
+      frictionforce = frictionforce_ground;
+  }
+
+  /* apply velocity to the player */
+  player->yposdelta += (player->velocityy * elapsed_time);
+  player->xposdelta += (player->velocityx * elapsed_time);
+
+  /* update player's position */
+  while (player->yposdelta <= -1000000) { /* DOWN */
+    player->yposdelta += 1000000;
+    if (player->ypos > 0) {
+      if (airborne != 0) {
+        player->ypos -= 1;
+        /* recompute neighbors to check if we are still flying */
+        compute_neighbors(world, player, sprites);
+        if (player->neighbors_below == 0) airborne = 1; else airborne = 0;
+      }
+    }
+  }
+  while (player->yposdelta >= 1000000) { /* UP */
+    player->yposdelta -= 1000000;
+    if (player->ypos < 0xFFFFFFF) { /* just a dumb limit to avoid the player going that high in case of a bug in the game... */
+      if (player->neighbors_above == 0) player->ypos += 1;
+      compute_neighbors(world, player, sprites); /* recompute neighbors */
+    }
+  }
+  while (player->xposdelta >= 1000000) { /* RIGHT */
+    player->xposdelta -= 1000000;
+    if (player->xpos < 0xFFFFFFF) { /* just a dumb limit to avoid the player going that high in case of a bug in the game... */
+      if (player->neighbors_right == 0) player->xpos += 1;
+      compute_neighbors(world, player, sprites); /* recompute neighbors */
+    }
+  }
+  while (player->xposdelta <= -1000000) { /* LEFT */
+    player->xposdelta += 1000000;
+    if (player->xpos > 0) {
+      if (player->neighbors_left == 0) player->xpos -= 1;
+      compute_neighbors(world, player, sprites); /* recompute neighbors */
+    }
+  }
+
+  /* apply gravity if we are airborne */
+  if (airborne != 0) {
+      player->velocityy -= (gravityforce * elapsed_time);
+    } else {  /* we are on ground, so no velocity */
+      player->velocityy = 0;
+  }
+
+  /* apply collisions static forces if we are currently colliding with something */
+  if ((player->neighbors_above != 0) && (player->velocityy > 0)) { /* collision above */
+    player->velocityy -= (collisionvelocityloss * elapsed_time);
+    if (player->velocityy < 0) player->velocityy = 0;
+    player->airborne_timer = 1000; /* special case for upward collisions: forbid any more jump acceleration on collision */
+  }
+  if ((player->neighbors_below != 0) && (player->velocityy < 0)) { /* collision below */
+    player->velocityy += (collisionvelocityloss * elapsed_time);
+    if (player->velocityy > 0) player->velocityy = 0;
+  }
+  if ((player->neighbors_left != 0) && (player->velocityx < 0)) { /* collision left */
+    player->velocityx += (collisionvelocityloss * elapsed_time);
+    if (player->velocityx > 0) player->velocityx = 0;
+  }
+  if ((player->neighbors_right != 0) && (player->velocityx > 0)) { /* collision right */
+    player->velocityx -= (collisionvelocityloss * elapsed_time);
+    if (player->velocityx < 0) player->velocityx = 0;
+  }
+
+  /* apply friction force */
+  if (player->velocityx > 0) {
+      player->velocityx -= (frictionforce * elapsed_time);
+      if (player->velocityx < 0) player->velocityx = 0;
+    } else if (player->velocityx < 0) {
+      player->velocityx += (frictionforce * elapsed_time);
+      if (player->velocityx > 0) player->velocityx = 0;
+  }
+
+  /* apply user-driven impulses */
+  if (keybstate->jump != 0) {
+    if (player->airborne_timer < jumptimelimit) { /* jumping is authorized only for a short time */
+      player->velocityy += (jumpimpulse * elapsed_time); /* jumping requires a tremendous acceleration */
+    } else { /* if time limit reached, turn off the jump key manually */
+      keybstate->jump = 0;
+    }
+  }
+  if (keybstate->left != 0) player->velocityx -= (frictionforce * 3 * elapsed_time);
+  if (keybstate->right != 0) player->velocityx += (frictionforce * 3 * elapsed_time);
+
+  /* limit max velocity (speed) */
+  if (player->velocityx < minhvelocity) player->velocityx = minhvelocity;
+  if (player->velocityx > maxhvelocity) player->velocityx = maxhvelocity;
+  if (player->velocityy < minvvelocity) player->velocityy = minvvelocity;
+  if (player->velocityy > maxvvelocity) player->velocityy = maxvvelocity;
+
+  /* printf("air: %d / vely: %d / yposdelta: %d / up: %d\n", airborne, player->velocityy, player->yposdelta, keybstate->up); */
+
+  #undef gravityforce
+  #undef frictionforce_air
+  #undef frictionforce_ground
+  #undef maxvelocity
+  #undef minvelocity
+  #undef jumpimpulse
+  #undef jumptimelimit
+  #undef collisionvelocityloss
+}
+
+
+
+/* returns non-zero if the player overlaps an object of the given type */
+int touchesobject(struct worldstruct *world, struct character *player, struct spritesstruct *sprites, int type) {
+  int found[16], count, i, tw = sprites->tiles[0]->w, th = sprites->tiles[0]->h;
+  /* from the tile under the first pixel of the sprite to the one under its last pixel */
+  count = findobjects(world, player->xpos / tw, player->ypos / th, (player->xpos + player->sprite->w - 1) / tw - player->xpos / tw + 1, (player->ypos + player->sprite->h - 1) / th - player->ypos / th + 1, found, 16);
+  for (i = 0; i < count; i++) {
+    if (world->objects[found[i]].type == type) return(1);
+  }
+  return(0);
+}
+
+
+
+int updatekeyboard(struct virtualkeyboard *keybstate, SDL_Event *event) {
+  int newstate = 0;
+  if ((event->type != SDL_KEYDOWN) && (event->type != SDL_KEYUP)) return(0);
+  if (event->type == SDL_KEYDOWN) newstate = 1;
+  switch (event->key.keysym.sym) {
+    case SDLK_LALT:
+      keybstate->jump = newstate;
+      break;
+    case SDLK_DOWN:
+      keybstate->down = newstate;
+      break;
+    case SDLK_LEFT:
+      keybstate->left = newstate;
+      break;
+    case SDLK_RIGHT:
+      keybstate->right = newstate;
+      break;
+    default:
+      return(0);
+  }
+  return(1);
+}
@@ -0,0 +1,86 @@
+/* game engine of Mike O'Possum
+ *
+ * The physics of the player and the drawing of the world, on a worldstruct
+ * that may come from anywhere: the game plays the levels it loads, the
+ * editor plays the very world being edited, in memory. */
+
+#ifndef ENGINE_H_SENTINEL
+#define ENGINE_H_SENTINEL
+
+#include <SDL/SDL.h>
+
+#include "level.h"
+#include "atlas.h"
+
+struct character {
+  int xpos;   /* current x position in the world */
+  int ypos;   /* current y position in the world */
+  int xposdelta; /* current x position delta, in micro pixels */
+  int yposdelta; /* current y position delta, in micro pixels */
+  int velocityx; /* horizontal velocity (is he moving? negative value for left movement or positive value for right movement) */
+  int velocityy; /* vertical velocity (is he moving? negative value for down movement or positive value for up movement) */
+  int airborne_timer;  /* how long the player is flying (used to limit the jump ability) */
+  int spritedir;   /* the direction of the sprite (0 = left / 1 = right) */
+  int spritestate;  /* the state of the sprite (0 = standing, 1, first step, etc) */
+  int spritestate_duration; /* the time for which the current sprite was displayed (used for animations) */
+  SDL_Surface *sprite;
+  int collisionoffset_down;   /* how many pixels do we have to ignore for collision detection */
+  int collisionoffset_up;     /* how many pixels do we have to ignore for collision detection */
+  int collisionoffset_left;   /* how many pixels do we have to ignore for collision detection */
+  int collisionoffset_right;  /* how many pixels do we have to ignore for collision detection */
+  char neighbors_above_left;  /* what kind of neigbors we have */
+  char neighbors_above;       /* what kind of neigbors we have */
+  char neighbors_above_right; /* what kind of neigbors we have */
+  char neighbors_right;       /* what kind of neigbors we have */
+  char neighbors_below_right; /* what kind of neigbors we have */
+  char neighbors_below;       /* what kind of neigbors we have */
+  char neighbors_below_left;  /* what kind of neigbors we have */
+  char neighbors_left;        /* what kind of neigbors we have */
+};
+
+struct virtualkeyboard {
+  int left;
+  int right;
+  int up;
+  int down;
+  int jump;
+  int shoot;
+};
+
+struct spritesstruct {
+  SDL_Surface *player[2][16];
+  SDL_Surface *tiles[64];
+  int tilescount;
+  int playercount;          /* frames of the player, in each direction */
+  struct atlas atlas;       /* all the tiles and frames above, packed together by packsprites() */
+  struct atlasregion tileregion[64]; /* where drawing blits each tile from */
+  struct atlasregion playerregion[2][16];
+};
+
+
+/* packs the tiles and the player frames into the atlas of sprites, which
+ * drawing blits from, in the format of the screen. must be called once
+ * they are all loaded and the video mode is set, and again whenever they
+ * change. drawscreen() calls it again by itself if the video mode changes. */
+void packsprites(struct spritesstruct *sprites);
+
+/* frees the atlas of sprites */
+void freesprites(struct spritesstruct *sprites);
+
+/* draws the world and the player on screen, the view following the player */
+void drawscreen(SDL_Surface *screen, struct spritesstruct *sprites, struct character *player, struct worldstruct *world, struct virtualkeyboard *keybstate, int elapsed_time);
+
+/* finds out what is around the player, using the collision grid of the world */
+void compute_neighbors(struct worldstruct *world, struct character *player, struct spritesstruct *sprites);
+
+/* computes all the physics in the world */
+void run_engine(struct worldstruct *world, struct character *player, int elapsed_time, struct spritesstruct *sprites, struct virtualkeyboard *keybstate);
+
+/* returns non-zero if the player overlaps an object of the given type */
+int touchesobject(struct worldstruct *world, struct character *player, struct spritesstruct *sprites, int type);
+
+/* updates the virtual keyboard with a key event. returns non-zero if the
+ * key is one the player is driven with. */
+int updatekeyboard(struct virtualkeyboard *keybstate, SDL_Event *event);
+
+#endif
@@ -0,0 +1,145 @@
+/* file watcher for Mike O'Possum */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), free() */
+#include <string.h>         /* strcmp(), strrchr() */
+#include <unistd.h>         /* read(), pipe(), close() */
+#include <poll.h>           /* poll() */
+#include <pthread.h>
+#include <sys/inotify.h>
+
+#include "filewatch.h"
+
+
+struct watchedfile {
+  char path[256];
+  char *name;     /* points to the file name part of path */
+  int wd;         /* inotify watch descriptor of the file's directory */
+  filewatch_callback callback;
+  void *userdata;
+};
+
+struct filewatch {
+  int fd;           /* inotify instance */
+  int stoppipe[2];  /* written to when the thread must quit */
+  pthread_t thread;
+  pthread_mutex_t lock;
+  int count;
+  struct watchedfile file[FILEWATCH_MAXFILES];
+};
+
+
+static void *filewatch_thread(void *arg) {
+  struct filewatch *fw = arg;
+  struct pollfd pfd[2];
+  struct inotify_event *ev;
+  struct watchedfile hit[FILEWATCH_MAXFILES];
+  char buff[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+  long len, i;
+  int f, hits;
+  pfd[0].fd = fw->fd;
+  pfd[0].events = POLLIN;
+  pfd[1].fd = fw->stoppipe[0];
+  pfd[1].events = POLLIN;
+  for (;;) {
+    if (poll(pfd, 2, -1) < 0) continue;
+    if (pfd[1].revents != 0) break;
+    len = read(fw->fd, buff, sizeof(buff));
+    if (len <= 0) continue;
+    /* find out what files have been touched, then call back without holding the lock */
+    hits = 0;
+    pthread_mutex_lock(&fw->lock);
+    for (i = 0; i < len; i += sizeof(struct inotify_event) + ev->len) {
+      ev = (struct inotify_event *)(buff + i);
+      if ((ev->len == 0) || ((ev->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) == 0)) continue;
+      for (f = 0; f < fw->count; f++) {
+        if ((fw->file[f].wd == ev->wd) && (strcmp(fw->file[f].name, ev->name) == 0) && (hits < FILEWATCH_MAXFILES)) {
+          hit[hits++] = fw->file[f];
+        }
+      }
+    }
+    pthread_mutex_unlock(&fw->lock);
+    for (f = 0; f < hits; f++) hit[f].callback(hit[f].path, hit[f].userdata);
+  }
+  return(NULL);
+}
+
+
+struct filewatch *filewatch_start(void) {
+  struct filewatch *fw;
+  fw = malloc(sizeof(struct filewatch));
+  if (fw == NULL) return(NULL);
+  fw->count = 0;
+  fw->fd = inotify_init();
+  if (fw->fd < 0) {
+    free(fw);
+    return(NULL);
+  }
+  if (pipe(fw->stoppipe) != 0) {
+    close(fw->fd);
+    free(fw);
+    return(NULL);
+  }
+  pthread_mutex_init(&fw->lock, NULL);
+  if (pthread_create(&fw->thread, NULL, filewatch_thread, fw) != 0) {
+    close(fw->stoppipe[0]);
+    close(fw->stoppipe[1]);
+    close(fw->fd);
+    pthread_mutex_destroy(&fw->lock);
+    free(fw);
+    return(NULL);
+  }
+  return(fw);
+}
+
+
+int filewatch_add(struct filewatch *fw, char *file, filewatch_callback callback, void *userdata) {
+  struct watchedfile *wf;
+  char dir[256], *slash;
+  int i, res = 0;
+  if (strlen(file) >= sizeof(wf->path)) return(-1);
+  pthread_mutex_lock(&fw->lock);
+  for (i = 0; i < fw->count; i++) {
+    if ((strcmp(fw->file[i].path, file) == 0) && (fw->file[i].callback == callback) && (fw->file[i].userdata == userdata)) break;
+  }
+  if (i < fw->count) { /* already watched */
+      res = 0;
+    } else if (fw->count == FILEWATCH_MAXFILES) {
+      res = -1;
+    } else {
+      wf = &(fw->file[fw->count]);
+      strcpy(wf->path, file);
+      /* split the path into its directory and file name */
+      slash = strrchr(wf->path, '/');
+      if (slash == NULL) {
+          strcpy(dir, ".");
+          wf->name = wf->path;
+        } else {
+          memcpy(dir, wf->path, slash - wf->path);
+          dir[slash - wf->path] = 0;
+          if (slash == wf->path) strcpy(dir, "/");
+          wf->name = slash + 1;
+      }
+      wf->wd = inotify_add_watch(fw->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO);
+      wf->callback = callback;
+      wf->userdata = userdata;
+      if (wf->wd < 0) {
+          res = -1;
+        } else {
+          fw->count++;
+      }
+  }
+  pthread_mutex_unlock(&fw->lock);
+  return(res);
+}
+
+
+void filewatch_stop(struct filewatch *fw) {
+  if (fw == NULL) return;
+  if (write(fw->stoppipe[1], "", 1) == 1) pthread_join(fw->thread, NULL);
+  close(fw->stoppipe[0]);
+  close(fw->stoppipe[1]);
+  close(fw->fd);
+  pthread_mutex_destroy(&fw->lock);
+  free(fw);
+}
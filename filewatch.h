@@ -0,0 +1,28 @@
+/* file watcher for Mike O'Possum
+ *
+ * Watches files with inotify from a background thread, and calls back
+ * whenever one of them has been rewritten. The directory of each file is
+ * watched rather than the file itself, so files replaced by a rename()
+ * (atomic saves) are noticed as well. */
+
+#ifndef FILEWATCH_H_SENTINEL
+#define FILEWATCH_H_SENTINEL
+
+#define FILEWATCH_MAXFILES 32
+
+/* called from the watcher thread each time a watched file changed */
+typedef void (*filewatch_callback)(char *file, void *userdata);
+
+struct filewatch;
+
+/* starts the watcher thread. returns NULL on error (no inotify...) */
+struct filewatch *filewatch_start(void);
+
+/* adds a file to the watch list. watching the same file twice is a no-op.
+ * returns 0 on success. */
+int filewatch_add(struct filewatch *fw, char *file, filewatch_callback callback, void *userdata);
+
+/* stops the watcher thread and frees everything */
+void filewatch_stop(struct filewatch *fw);
+
+#endif
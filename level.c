@@ -0,0 +1,714 @@
+/* level file handling for Mike O'Possum */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), free() */
+#include <string.h>         /* memcpy(), memcmp() */
+#include <fcntl.h>          /* open() */
+#include <unistd.h>         /* pread(), close() */
+#include <sys/stat.h>       /* fstat(), fchmod() */
+#include <pthread.h>        /* pthread_once() */
+
+#include "level.h"
+
+
+/*** CRC32C ***/
+
+static unsigned int crc32c_table[256];
+static int crc32c_hw;      /* 0 = no crc32 instruction, 1 = hw crc32 available */
+static pthread_once_t crc32c_once = PTHREAD_ONCE_INIT; /* crc32c() is called from several threads at once */
+
+static void crc32c_init(void) {
+  unsigned int i, j, crc;
+  for (i = 0; i < 256; i++) {
+    crc = i;
+    for (j = 0; j < 8; j++) crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+    crc32c_table[i] = crc;
+  }
+  crc32c_hw = 0;
+  #if defined(__GNUC__) && defined(__x86_64__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse4.2")) crc32c_hw = 1;
+  #elif defined(__ARM_FEATURE_CRC32)
+  crc32c_hw = 1;
+  #endif
+}
+
+static unsigned int crc32c_sw(unsigned int crc, const unsigned char *buf, long len) {
+  while (len-- > 0) crc = crc32c_table[(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+  return(crc);
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("sse4.2"))) static unsigned int crc32c_hwcalc(unsigned int crc, const unsigned char *buf, long len) {
+  unsigned long crc64 = crc, word;
+  /* process 8 bytes per instruction for the bulk of the buffer */
+  while (len >= 8) {
+    memcpy(&word, buf, 8);
+    crc64 = __builtin_ia32_crc32di(crc64, word);
+    buf += 8;
+    len -= 8;
+  }
+  crc = (unsigned int)crc64;
+  while (len-- > 0) crc = __builtin_ia32_crc32qi(crc, *buf++);
+  return(crc);
+}
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+static unsigned int crc32c_hwcalc(unsigned int crc, const unsigned char *buf, long len) {
+  unsigned int word;
+  while (len >= 4) {
+    memcpy(&word, buf, 4);
+    crc = __crc32cw(crc, word);
+    buf += 4;
+    len -= 4;
+  }
+  while (len-- > 0) crc = __crc32cb(crc, *buf++);
+  return(crc);
+}
+#else
+#define crc32c_hwcalc crc32c_sw
+#endif
+
+unsigned int crc32c(unsigned int crc, const void *buf, long len) {
+  pthread_once(&crc32c_once, crc32c_init);
+  crc = ~crc;
+  if (crc32c_hw != 0) {
+      crc = crc32c_hwcalc(crc, buf, len);
+    } else {
+      crc = crc32c_sw(crc, buf, len);
+  }
+  return(~crc);
+}
+
+
+/*** helpers ***/
+
+static void put16(unsigned char *p, unsigned int v) {
+  p[0] = (v >> 8) & 0xFF;
+  p[1] = v & 0xFF;
+}
+
+static void put32(unsigned char *p, unsigned long v) {
+  p[0] = (v >> 24) & 0xFF;
+  p[1] = (v >> 16) & 0xFF;
+  p[2] = (v >> 8) & 0xFF;
+  p[3] = v & 0xFF;
+}
+
+static unsigned int get16(const unsigned char *p) {
+  return((p[0] << 8) | p[1]);
+}
+
+static unsigned long get32(const unsigned char *p) {
+  return(((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) | ((unsigned long)p[2] << 8) | p[3]);
+}
+
+/* PackBits-style RLE: a control byte n in 0..127 is followed by n+1 literal
+ * bytes, a control byte n in 129..255 is followed by one byte to be repeated
+ * 257-n times. out must be able to hold len + len/128 + 1 bytes. returns the
+ * length of the packed data. */
+long rle_pack(unsigned char *out, const unsigned char *in, long len) {
+  long i = 0, o = 0, run, start;
+  while (i < len) {
+    run = 1;
+    while ((i + run < len) && (run < 128) && (in[i + run] == in[i])) run++;
+    if (run >= 2) {
+        out[o++] = (unsigned char)(257 - run);
+        out[o++] = in[i];
+        i += run;
+      } else { /* collect literals until the next run begins */
+        start = i;
+        while ((i < len) && (i - start < 128)) {
+          if ((i + 1 < len) && (in[i] == in[i + 1])) break;
+          i++;
+        }
+        out[o++] = (unsigned char)(i - start - 1);
+        memcpy(out + o, in + start, i - start);
+        o += i - start;
+    }
+  }
+  return(o);
+}
+
+/* unpacks exactly outlen bytes from in. returns the number of bytes of in
+ * that have been consumed, or -1 if in is corrupted. */
+long rle_unpack(unsigned char *out, long outlen, const unsigned char *in, long inlen) {
+  long i = 0, o = 0, n;
+  while (o < outlen) {
+    if (i >= inlen) return(-1);
+    n = in[i++];
+    if (n < 128) {
+        n += 1;
+        if ((i + n > inlen) || (o + n > outlen)) return(-1);
+        memcpy(out + o, in + i, n);
+        i += n;
+      } else if (n > 128) {
+        n = 257 - n;
+        if ((i >= inlen) || (o + n > outlen)) return(-1);
+        memset(out + o, in[i++], n);
+      } else {
+        continue; /* 128 is a no-op */
+    }
+    o += n;
+  }
+  return(i);
+}
+
+
+int writefileatomic(char *file, const void *buff, long len) {
+  char tmpname[1024], dirname[1024], *slash;
+  const unsigned char *p = buff;
+  struct stat st;
+  long done = 0, n;
+  int fd;
+  if (strlen(file) + 32 > sizeof(tmpname)) return(-1);
+  /* the temp file must live in the same directory, rename() can't cross filesystems */
+  sprintf(tmpname, "%s.tmp%ld", file, (long)getpid());
+  fd = open(tmpname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return(-1);
+  /* the file replaced keeps its permissions, whatever the umask */
+  if ((stat(file, &st) == 0) && (fchmod(fd, st.st_mode & 07777) != 0)) {
+    close(fd);
+    unlink(tmpname);
+    return(-1);
+  }
+  while (done < len) { /* a single write() normally, unless interrupted */
+    n = write(fd, p + done, len - done);
+    if (n <= 0) break;
+    done += n;
+  }
+  if ((done != len) || (fsync(fd) != 0)) {
+    close(fd);
+    unlink(tmpname);
+    return(-1);
+  }
+  if ((close(fd) != 0) || (rename(tmpname, file) != 0)) {
+    unlink(tmpname);
+    return(-1);
+  }
+  /* make the rename itself durable */
+  strcpy(dirname, file);
+  slash = strrchr(dirname, '/');
+  if (slash == NULL) {
+      strcpy(dirname, ".");
+    } else if (slash == dirname) {
+      dirname[1] = 0;
+    } else {
+      *slash = 0;
+  }
+  fd = open(dirname, O_RDONLY);
+  if (fd >= 0) {
+    fsync(fd);
+    close(fd);
+  }
+  return(0);
+}
+
+
+/*** worlds ***/
+
+void createemptyworld(struct worldstruct *world, int w, int h) {
+  memset(world->tilemap, 0, sizeof(world->tilemap));
+  memset(world->solid, 0, sizeof(world->solid));
+  world->width = w;
+  world->height = h;
+  world->objectcount = 0;
+  buildobjectgrid(world);
+}
+
+
+void buildcollisiongrid(struct worldstruct *world, int x, int y, int w, int h) {
+  int i, j;
+  for (i = x; (i < x + w) && (i < WORLD_MAXW); i++) {
+    if (i < 0) continue;
+    for (j = y; (j < y + h) && (j < WORLD_MAXH); j++) {
+      if (j < 0) continue;
+      world->solid[i][j] = (world->tilemap[i][j][COLLISION_LAYER] != 0);
+    }
+  }
+}
+
+
+/* returns the column (or row) of the object grid holding tile t */
+static int objgridcell(int t, int chunksize, int cells) {
+  if (t < 0) return(0);
+  t /= chunksize;
+  if (t >= cells) return(cells - 1);
+  return(t);
+}
+
+
+/* computes the range of grid cells covered by an object */
+static void objectcells(struct levelobject *obj, int *cx1, int *cy1, int *cx2, int *cy2) {
+  *cx1 = objgridcell(obj->x, LEVEL_CHUNKW, OBJGRID_COLS);
+  *cy1 = objgridcell(obj->y, LEVEL_CHUNKH, OBJGRID_ROWS);
+  *cx2 = objgridcell(obj->x + ((obj->w > 0) ? obj->w : 1) - 1, LEVEL_CHUNKW, OBJGRID_COLS);
+  *cy2 = objgridcell(obj->y + ((obj->h > 0) ? obj->h : 1) - 1, LEVEL_CHUNKH, OBJGRID_ROWS);
+}
+
+
+void buildobjectgrid(struct worldstruct *world) {
+  struct objectgrid *grid = &(world->objgrid);
+  int fill[OBJGRID_COLS * OBJGRID_ROWS];
+  int i, cx, cy, cx1, cy1, cx2, cy2;
+  /* count the objects of each cell, then lay the cells out one after another */
+  memset(fill, 0, sizeof(fill));
+  for (i = 0; i < world->objectcount; i++) {
+    objectcells(&(world->objects[i]), &cx1, &cy1, &cx2, &cy2);
+    for (cy = cy1; cy <= cy2; cy++) {
+      for (cx = cx1; cx <= cx2; cx++) fill[cy * OBJGRID_COLS + cx]++;
+    }
+  }
+  grid->cellstart[0] = 0;
+  for (i = 0; i < OBJGRID_COLS * OBJGRID_ROWS; i++) {
+    grid->cellstart[i + 1] = grid->cellstart[i] + fill[i];
+    fill[i] = grid->cellstart[i];
+  }
+  for (i = 0; i < world->objectcount; i++) {
+    objectcells(&(world->objects[i]), &cx1, &cy1, &cx2, &cy2);
+    for (cy = cy1; cy <= cy2; cy++) {
+      for (cx = cx1; cx <= cx2; cx++) grid->items[fill[cy * OBJGRID_COLS + cx]++] = i;
+    }
+  }
+}
+
+
+int findobjects(struct worldstruct *world, int x, int y, int w, int h, int *result, int maxresults) {
+  struct objectgrid *grid = &(world->objgrid);
+  struct levelobject *obj;
+  int qcx1, qcy1, qcx2, qcy2, ocx1, ocy1, ocx2, ocy2, cx, cy, i, found = 0;
+  if ((w <= 0) || (h <= 0)) return(0);
+  qcx1 = objgridcell(x, LEVEL_CHUNKW, OBJGRID_COLS);
+  qcy1 = objgridcell(y, LEVEL_CHUNKH, OBJGRID_ROWS);
+  qcx2 = objgridcell(x + w - 1, LEVEL_CHUNKW, OBJGRID_COLS);
+  qcy2 = objgridcell(y + h - 1, LEVEL_CHUNKH, OBJGRID_ROWS);
+  for (cy = qcy1; cy <= qcy2; cy++) {
+    for (cx = qcx1; cx <= qcx2; cx++) {
+      for (i = grid->cellstart[cy * OBJGRID_COLS + cx]; i < grid->cellstart[cy * OBJGRID_COLS + cx + 1]; i++) {
+        obj = &(world->objects[grid->items[i]]);
+        if ((obj->x >= x + w) || (obj->x + ((obj->w > 0) ? obj->w : 1) <= x)) continue;
+        if ((obj->y >= y + h) || (obj->y + ((obj->h > 0) ? obj->h : 1) <= y)) continue;
+        /* an object spanning several cells is reported only by the first
+         * cell it shares with the query, so no result is duplicated */
+        objectcells(obj, &ocx1, &ocy1, &ocx2, &ocy2);
+        if ((cx != ((ocx1 > qcx1) ? ocx1 : qcx1)) || (cy != ((ocy1 > qcy1) ? ocy1 : qcy1))) continue;
+        if (found < maxresults) result[found] = grid->items[i];
+        found++;
+      }
+    }
+  }
+  if (found > maxresults) found = maxresults;
+  return(found);
+}
+
+
+int loadlevel_legacy(char *file, struct worldstruct *world) {
+  FILE *worldfile;
+  int x, y, z;
+  unsigned char buff[4];
+  worldfile = fopen(file, "rb");
+  if (worldfile == NULL) return(-1);
+  /* compute the width/height of the world */
+  if (fread(buff, 4, 1, worldfile) != 1) {
+    fclose(worldfile);
+    return(-1);
+  }
+  if ((get16(buff) > WORLD_MAXW) || (get16(buff + 2) > WORLD_MAXH)) {
+    fclose(worldfile);
+    return(-1);
+  }
+  createemptyworld(world, get16(buff), get16(buff + 2));
+  /* read the world and populate the data table */
+  for (y = 0; y < world->height; y++) {
+    for (x = 0; x < world->width; x++) {
+      if (fread(buff, 4, 1, worldfile) != 1) {
+        fclose(worldfile);
+        return(-1);
+      }
+      for (z = 0; z < WORLD_LAYERS; z++) {
+        world->tilemap[x][y][z] = buff[z];
+      }
+    }
+  }
+  fclose(worldfile);
+  buildcollisiongrid(world, 0, 0, world->width, world->height);
+  return(0);
+}
+
+
+int savelevel_legacy(char *file, struct worldstruct *world) {
+  unsigned char *buff, *p;
+  long len;
+  int x, y, z, res;
+  len = 4 + ((long)world->width * world->height * WORLD_LAYERS);
+  buff = malloc(len);
+  if (buff == NULL) return(-1);
+  put16(buff, world->width);
+  put16(buff + 2, world->height);
+  p = buff + 4;
+  for (y = 0; y < world->height; y++) {
+    for (x = 0; x < world->width; x++) {
+      for (z = 0; z < WORLD_LAYERS; z++) *p++ = world->tilemap[x][y][z];
+    }
+  }
+  res = writefileatomic(file, buff, len);
+  free(buff);
+  return(res);
+}
+
+
+/*** chunked container ***/
+
+/* packs the chunk (cx,cy) of the world into out, and fills its directory
+ * entry (except the offset). returns the length of the packed chunk. */
+static long packchunk(unsigned char *out, struct worldstruct *world, int cx, int cy, struct levelchunkentry *entry) {
+  unsigned char layer[LEVEL_CHUNKW * LEVEL_CHUNKH];
+  int x, y, z, wx, wy, empty;
+  long len = 0;
+  entry->layermask = 0;
+  for (z = 0; z < WORLD_LAYERS; z++) {
+    empty = 1;
+    for (y = 0; y < LEVEL_CHUNKH; y++) {
+      wy = cy * LEVEL_CHUNKH + y;
+      for (x = 0; x < LEVEL_CHUNKW; x++) {
+        wx = cx * LEVEL_CHUNKW + x;
+        if ((wx < world->width) && (wy < world->height)) {
+            layer[y * LEVEL_CHUNKW + x] = world->tilemap[wx][wy][z];
+          } else {
+            layer[y * LEVEL_CHUNKW + x] = 0;
+        }
+        if (layer[y * LEVEL_CHUNKW + x] != 0) empty = 0;
+      }
+    }
+    if (empty != 0) continue; /* empty layers are not stored at all */
+    entry->layermask |= (1 << z);
+    len += rle_pack(out + len, layer, sizeof(layer));
+  }
+  entry->size = len;
+  entry->crc = crc32c(0, out, len);
+  return(len);
+}
+
+
+unsigned char *packlevel(struct worldstruct *world, long *len) {
+  unsigned char *buff, *p;
+  struct levelchunkentry entry;
+  int cx, cy, cols, rows, i;
+  long maxlen, offset, dirlen, objoffset;
+  unsigned int proplen;
+  cols = (world->width + LEVEL_CHUNKW - 1) / LEVEL_CHUNKW;
+  rows = (world->height + LEVEL_CHUNKH - 1) / LEVEL_CHUNKH;
+  dirlen = (long)cols * rows * LEVEL_DIRENTRYLEN;
+  /* worst case: every layer of every chunk is incompressible */
+  maxlen = LEVEL_HEADERLEN + dirlen + (long)cols * rows * WORLD_LAYERS * (LEVEL_CHUNKW * LEVEL_CHUNKH + (LEVEL_CHUNKW * LEVEL_CHUNKH) / 128 + 1);
+  maxlen += (long)world->objectcount * (LEVEL_OBJRECORDLEN + OBJECT_PROPSLEN);
+  buff = malloc(maxlen);
+  if (buff == NULL) return(NULL);
+  memset(buff, 0, LEVEL_HEADERLEN + dirlen);
+  /* write all chunks first, filling the directory along the way */
+  offset = LEVEL_HEADERLEN + dirlen;
+  i = 0;
+  for (cy = 0; cy < rows; cy++) {
+    for (cx = 0; cx < cols; cx++) {
+      entry.offset = offset;
+      offset += packchunk(buff + offset, world, cx, cy, &entry);
+      p = buff + LEVEL_HEADERLEN + (i++ * LEVEL_DIRENTRYLEN);
+      put32(p, entry.offset);
+      put32(p + 4, entry.size);
+      p[8] = entry.layermask;
+      put32(p + 12, entry.crc);
+    }
+  }
+  /* then the object table */
+  objoffset = offset;
+  for (i = 0; i < world->objectcount; i++) {
+    proplen = strlen(world->objects[i].props);
+    p = buff + offset;
+    put16(p, world->objects[i].type);
+    put16(p + 2, world->objects[i].x);
+    put16(p + 4, world->objects[i].y);
+    put16(p + 6, world->objects[i].w);
+    put16(p + 8, world->objects[i].h);
+    put16(p + 10, 0);
+    put16(p + 12, proplen);
+    memcpy(p + LEVEL_OBJRECORDLEN, world->objects[i].props, proplen);
+    offset += LEVEL_OBJRECORDLEN + proplen;
+  }
+  /* now the header */
+  memcpy(buff, LEVEL_MAGIC, 4);
+  put16(buff + 4, LEVEL_VERSION);
+  put16(buff + 6, 0);
+  put16(buff + 8, world->width);
+  put16(buff + 10, world->height);
+  buff[12] = LEVEL_CHUNKW;
+  buff[13] = LEVEL_CHUNKH;
+  buff[14] = WORLD_LAYERS;
+  put32(buff + 16, (unsigned long)cols * rows);
+  put32(buff + 20, LEVEL_HEADERLEN);
+  put32(buff + 24, crc32c(0, buff + LEVEL_HEADERLEN, dirlen));
+  put32(buff + 28, world->objectcount);
+  put32(buff + 32, objoffset);
+  put32(buff + 36, offset - objoffset);
+  put32(buff + 40, crc32c(0, buff + objoffset, offset - objoffset));
+  put32(buff + 44, crc32c(0, buff, 44));
+  *len = offset;
+  return(buff);
+}
+
+
+int savelevel(char *file, struct worldstruct *world) {
+  unsigned char *buff;
+  long len;
+  int res;
+  buff = packlevel(world, &len);
+  if (buff == NULL) return(-1);
+  res = writefileatomic(file, buff, len);
+  free(buff);
+  return(res);
+}
+
+
+void closelevel(struct levelfile *lf) {
+  if (lf->fd >= 0) close(lf->fd);
+  lf->fd = -1;
+  free(lf->dir);
+  lf->dir = NULL;
+}
+
+
+int openlevel(char *file, struct levelfile *lf) {
+  unsigned char hdr[LEVEL_HEADERLEN], *dir;
+  unsigned long count, diroffset, dirlen, i;
+  struct stat st;
+  long hdrlen;
+  lf->dir = NULL;
+  lf->fd = open(file, O_RDONLY);
+  if (lf->fd < 0) return(-1);
+  if (fstat(lf->fd, &st) != 0) goto FAIL;
+  hdrlen = pread(lf->fd, hdr, LEVEL_HEADERLEN, 0);
+  if (hdrlen < LEVEL_HEADERLEN_V1) goto FAIL;
+  /* validate the header */
+  if (memcmp(hdr, LEVEL_MAGIC, 4) != 0) goto FAIL;
+  lf->objcount = 0;
+  lf->objoffset = 0;
+  lf->objsize = 0;
+  lf->objcrc = 0;
+  if (get16(hdr + 4) == 1) { /* version 1: no objects */
+      if (get32(hdr + 28) != crc32c(0, hdr, 28)) goto FAIL;
+    } else if (get16(hdr + 4) == LEVEL_VERSION) {
+      if ((hdrlen < LEVEL_HEADERLEN) || (get32(hdr + 44) != crc32c(0, hdr, 44))) goto FAIL;
+      lf->objcount = get32(hdr + 28);
+      lf->objoffset = get32(hdr + 32);
+      lf->objsize = get32(hdr + 36);
+      lf->objcrc = get32(hdr + 40);
+      if ((lf->objcount > WORLD_MAXOBJECTS) || (lf->objoffset + lf->objsize > (unsigned long)st.st_size)) goto FAIL;
+    } else {
+      goto FAIL;
+  }
+  if (hdr[14] != WORLD_LAYERS) goto FAIL;
+  lf->width = get16(hdr + 8);
+  lf->height = get16(hdr + 10);
+  lf->chunkw = hdr[12];
+  lf->chunkh = hdr[13];
+  if ((lf->width > WORLD_MAXW) || (lf->height > WORLD_MAXH)) goto FAIL;
+  if ((lf->chunkw == 0) || (lf->chunkh == 0) || (lf->chunkw * lf->chunkh > LEVEL_CHUNKW * LEVEL_CHUNKH)) goto FAIL;
+  lf->chunkcols = (lf->width + lf->chunkw - 1) / lf->chunkw;
+  lf->chunkrows = (lf->height + lf->chunkh - 1) / lf->chunkh;
+  count = get32(hdr + 16);
+  diroffset = get32(hdr + 20);
+  dirlen = count * LEVEL_DIRENTRYLEN;
+  if (count != (unsigned long)lf->chunkcols * lf->chunkrows) goto FAIL;
+  if (diroffset + dirlen > (unsigned long)st.st_size) goto FAIL;
+  /* load and validate the chunk directory */
+  dir = malloc(dirlen + 1);
+  lf->dir = malloc((count + 1) * sizeof(struct levelchunkentry));
+  if ((dir == NULL) || (lf->dir == NULL)) {
+    free(dir);
+    goto FAIL;
+  }
+  if ((pread(lf->fd, dir, dirlen, diroffset) != (long)dirlen) || (get32(hdr + 24) != crc32c(0, dir, dirlen))) {
+    free(dir);
+    goto FAIL;
+  }
+  for (i = 0; i < count; i++) {
+    lf->dir[i].offset = get32(dir + i * LEVEL_DIRENTRYLEN);
+    lf->dir[i].size = get32(dir + i * LEVEL_DIRENTRYLEN + 4);
+    lf->dir[i].layermask = dir[i * LEVEL_DIRENTRYLEN + 8];
+    lf->dir[i].crc = get32(dir + i * LEVEL_DIRENTRYLEN + 12);
+    if (lf->dir[i].offset + lf->dir[i].size > (unsigned long)st.st_size) break;
+    /* chunks must be stored in directory order, this is what makes a single pread() per region possible */
+    if ((i > 0) && (lf->dir[i].offset < lf->dir[i - 1].offset + lf->dir[i - 1].size)) break;
+  }
+  free(dir);
+  if (i != count) goto FAIL;
+  return(0);
+
+  FAIL:
+  closelevel(lf);
+  return(-1);
+}
+
+
+/* unpacks a chunk into the world. returns 0 on success. */
+static int unpackchunk(struct levelfile *lf, struct worldstruct *world, int cx, int cy, const unsigned char *data) {
+  struct levelchunkentry *entry = &(lf->dir[cy * lf->chunkcols + cx]);
+  unsigned char layer[LEVEL_CHUNKW * LEVEL_CHUNKH];
+  long used = 0, n;
+  int x, y, z, wx, wy;
+  if (crc32c(0, data, entry->size) != entry->crc) return(-1);
+  for (z = 0; z < WORLD_LAYERS; z++) {
+    if (entry->layermask & (1 << z)) {
+        n = rle_unpack(layer, lf->chunkw * lf->chunkh, data + used, entry->size - used);
+        if (n < 0) return(-1);
+        used += n;
+      } else {
+        memset(layer, 0, lf->chunkw * lf->chunkh);
+    }
+    for (y = 0; y < lf->chunkh; y++) {
+      wy = cy * lf->chunkh + y;
+      if (wy >= lf->height) break;
+      for (x = 0; x < lf->chunkw; x++) {
+        wx = cx * lf->chunkw + x;
+        if (wx >= lf->width) break;
+        world->tilemap[wx][wy][z] = layer[y * lf->chunkw + x];
+      }
+    }
+  }
+  return(0);
+}
+
+
+int readlevelregion(struct levelfile *lf, struct worldstruct *world, int x, int y, int w, int h) {
+  int cx, cy, cx1, cy1, cx2, cy2, res = 0;
+  unsigned long start, end;
+  unsigned char *buff;
+  /* clip the region to the world */
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > lf->width) w = lf->width - x;
+  if (y + h > lf->height) h = lf->height - y;
+  if ((w <= 0) || (h <= 0)) return(0);
+  cx1 = x / lf->chunkw;
+  cy1 = y / lf->chunkh;
+  cx2 = (x + w - 1) / lf->chunkw;
+  cy2 = (y + h - 1) / lf->chunkh;
+  /* chunks are stored in directory order, so all chunks of the region live
+   * between the first and the last one - fetch all of that at once */
+  start = lf->dir[cy1 * lf->chunkcols + cx1].offset;
+  end = lf->dir[cy2 * lf->chunkcols + cx2].offset + lf->dir[cy2 * lf->chunkcols + cx2].size;
+  buff = malloc(end - start + 1);
+  if (buff == NULL) return(-1);
+  if (pread(lf->fd, buff, end - start, start) != (long)(end - start)) {
+    free(buff);
+    return(-1);
+  }
+  world->width = lf->width;
+  world->height = lf->height;
+  for (cy = cy1; cy <= cy2; cy++) {
+    for (cx = cx1; cx <= cx2; cx++) {
+      if (unpackchunk(lf, world, cx, cy, buff + (lf->dir[cy * lf->chunkcols + cx].offset - start)) != 0) res = -1;
+    }
+  }
+  free(buff);
+  buildcollisiongrid(world, cx1 * lf->chunkw, cy1 * lf->chunkh, (cx2 - cx1 + 1) * lf->chunkw, (cy2 - cy1 + 1) * lf->chunkh);
+  return(res);
+}
+
+
+int readlevelobjects(struct levelfile *lf, struct worldstruct *world) {
+  unsigned char *buff, *p;
+  unsigned long i, proplen;
+  struct levelobject *obj;
+  world->objectcount = 0;
+  buff = malloc(lf->objsize + 1);
+  if (buff == NULL) return(-1);
+  if ((pread(lf->fd, buff, lf->objsize, lf->objoffset) != (long)lf->objsize) || (crc32c(0, buff, lf->objsize) != lf->objcrc)) {
+    free(buff);
+    buildobjectgrid(world);
+    return(-1);
+  }
+  p = buff;
+  for (i = 0; i < lf->objcount; i++) {
+    if (p + LEVEL_OBJRECORDLEN > buff + lf->objsize) break;
+    proplen = get16(p + 12);
+    if (p + LEVEL_OBJRECORDLEN + proplen > buff + lf->objsize) break;
+    obj = &(world->objects[world->objectcount++]);
+    memset(obj, 0, sizeof(struct levelobject));
+    obj->type = get16(p);
+    obj->x = get16(p + 2);
+    obj->y = get16(p + 4);
+    obj->w = get16(p + 6);
+    obj->h = get16(p + 8);
+    if (proplen >= OBJECT_PROPSLEN) proplen = OBJECT_PROPSLEN - 1;
+    memcpy(obj->props, p + LEVEL_OBJRECORDLEN, proplen);
+    obj->props[proplen] = 0;
+    p += LEVEL_OBJRECORDLEN + get16(p + 12);
+  }
+  free(buff);
+  buildobjectgrid(world);
+  if (i != lf->objcount) return(-1);
+  return(0);
+}
+
+
+int loadlevel(char *file, struct worldstruct *world) {
+  struct levelfile lf;
+  FILE *fd;
+  char magic[4];
+  int res;
+  /* peek at the magic to find out what kind of file this is */
+  fd = fopen(file, "rb");
+  if (fd == NULL) return(-1);
+  res = fread(magic, 4, 1, fd);
+  fclose(fd);
+  if ((res != 1) || (memcmp(magic, LEVEL_MAGIC, 4) != 0)) return(loadlevel_legacy(file, world));
+  if (openlevel(file, &lf) != 0) return(-1);
+  createemptyworld(world, lf.width, lf.height);
+  res = readlevelregion(&lf, world, 0, 0, lf.width, lf.height);
+  if (readlevelobjects(&lf, world) != 0) res = -1;
+  closelevel(&lf);
+  return(res);
+}
+
+
+int verifylevel(char *file) {
+  struct levelfile lf;
+  unsigned long i, count, end;
+  unsigned char *buff;
+  int res = 0;
+  if (openlevel(file, &lf) != 0) return(-1);
+  /* the object table first */
+  buff = malloc(lf.objsize + 1);
+  if ((buff == NULL) || (pread(lf.fd, buff, lf.objsize, lf.objoffset) != (long)lf.objsize)) {
+    free(buff);
+    closelevel(&lf);
+    return(-1);
+  }
+  if (crc32c(0, buff, lf.objsize) != lf.objcrc) res++;
+  free(buff);
+  count = (unsigned long)lf.chunkcols * lf.chunkrows;
+  if (count == 0) {
+    closelevel(&lf);
+    return(res);
+  }
+  /* fetch all chunks with a single read, then checksum them one by one */
+  end = lf.dir[count - 1].offset + lf.dir[count - 1].size;
+  buff = malloc(end - lf.dir[0].offset + 1);
+  if ((buff == NULL) || (pread(lf.fd, buff, end - lf.dir[0].offset, lf.dir[0].offset) != (long)(end - lf.dir[0].offset))) {
+    free(buff);
+    closelevel(&lf);
+    return(-1);
+  }
+  for (i = 0; i < count; i++) {
+    if (crc32c(0, buff + (lf.dir[i].offset - lf.dir[0].offset), lf.dir[i].size) != lf.dir[i].crc) res++;
+  }
+  free(buff);
+  closelevel(&lf);
+  return(res);
+}
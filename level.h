@@ -0,0 +1,207 @@
+/* level file handling for Mike O'Possum
+ *
+ * Two on-disk formats are understood:
+ *
+ *  - the legacy format: a 4-bytes header (width and height, both 16 bits
+ *    big endian) followed by a flat dump of width*height cells, 4 bytes per
+ *    cell (one byte per layer), row after row starting at the bottom row.
+ *
+ *  - the chunked container: a fixed 32-bytes header, followed by a chunk
+ *    directory, followed by the chunks themselves. Each chunk holds a
+ *    LEVEL_CHUNKW x LEVEL_CHUNKH area of the world, each of its non-empty
+ *    layers being RLE-packed. Every directory entry carries the offset,
+ *    compressed size, layer mask and CRC32C of its chunk, so any region of
+ *    the world can be fetched with a single pread() and checked on the fly.
+ *
+ * All multi-bytes values are stored big endian.
+ *
+ * header (48 bytes):
+ *   0  magic "APLV"
+ *   4  version (16 bits)
+ *   6  flags (16 bits, reserved, 0)
+ *   8  width in tiles (16 bits)
+ *  10  height in tiles (16 bits)
+ *  12  chunk width, chunk height, layers count, reserved (8 bits each)
+ *  16  chunks count (32 bits)
+ *  20  offset of the chunk directory (32 bits)
+ *  24  CRC32C of the chunk directory (32 bits)
+ *  28  objects count (32 bits)
+ *  32  offset of the object table (32 bits)
+ *  36  size of the object table (32 bits)
+ *  40  CRC32C of the object table (32 bits)
+ *  44  CRC32C of the 44 header bytes above (32 bits)
+ * version 1 files have no objects: their header is 32 bytes long and ends
+ * with the header CRC32C at offset 28.
+ *
+ * directory entry (16 bytes), one per chunk, row of chunks after row:
+ *   0  offset of the chunk data (32 bits)
+ *   4  compressed size of the chunk data (32 bits)
+ *   8  layer mask (bit z set = layer z is stored in the chunk), 3 reserved
+ *  12  CRC32C of the chunk data (32 bits)
+ *
+ * object record (14 bytes + properties), stored after the last chunk:
+ *   0  type (16 bits)
+ *   2  x, y, width, height in tiles (16 bits each)
+ *  10  reserved (16 bits, 0)
+ *  12  length of the properties string (16 bits), then the string itself
+ */
+
+#ifndef LEVEL_H_SENTINEL
+#define LEVEL_H_SENTINEL
+
+#define WORLD_MAXW 64   /* max width of a world, in tiles */
+#define WORLD_MAXH 64   /* max height of a world, in tiles */
+#define WORLD_LAYERS 4  /* how many layers of tiles a world has */
+#define WORLD_TILETYPES 64 /* how many different tiles there are, tiles being numbered from 0 */
+#define COLLISION_LAYER 2 /* the layer the player collides with, the layers above it are foreground */
+
+#define WORLD_MAXOBJECTS 256
+#define OBJECT_PROPSLEN 48
+
+#define LEVEL_MAGIC "APLV"
+#define LEVEL_VERSION 2
+#define LEVEL_HEADERLEN 48
+#define LEVEL_HEADERLEN_V1 32
+#define LEVEL_OBJRECORDLEN 14
+#define LEVEL_DIRENTRYLEN 16
+#define LEVEL_CHUNKW 16
+#define LEVEL_CHUNKH 16
+
+#define OBJGRID_COLS ((WORLD_MAXW + LEVEL_CHUNKW - 1) / LEVEL_CHUNKW)
+#define OBJGRID_ROWS ((WORLD_MAXH + LEVEL_CHUNKH - 1) / LEVEL_CHUNKH)
+
+struct SDL_Surface;
+
+enum objecttype {
+  OBJ_NONE = 0,
+  OBJ_SPAWN,    /* where the player starts */
+  OBJ_EXIT,     /* touching it ends the level */
+  OBJ_TRIGGER,
+  OBJ_ENEMY,
+  OBJ_PICKUP
+};
+
+/* an object of the level. positions and sizes are in tiles, with (0,0)
+ * being the bottom left corner of the world, like the tilemap. */
+struct levelobject {
+  int type;
+  int x;
+  int y;
+  int w;
+  int h;
+  char props[OBJECT_PROPSLEN];  /* "key=value" pairs separated by ';' */
+};
+
+/* spatial index of objects: a uniform grid with one cell per chunk, each
+ * cell listing the objects overlapping it */
+struct objectgrid {
+  short cellstart[OBJGRID_COLS * OBJGRID_ROWS + 1]; /* objects of cell c are items[cellstart[c]..cellstart[c+1]-1] */
+  short items[WORLD_MAXOBJECTS * OBJGRID_COLS * OBJGRID_ROWS];
+};
+
+struct worldstruct {
+  int width;
+  int height;
+  int tilemap[WORLD_MAXW][WORLD_MAXH][WORLD_LAYERS]; /* x, y, z */
+  struct SDL_Surface *bg;
+  int objectcount;
+  struct levelobject objects[WORLD_MAXOBJECTS];
+  /* caches derived from the tilemap and objects */
+  unsigned char solid[WORLD_MAXW][WORLD_MAXH]; /* collision grid: non-zero where the collision layer holds a tile */
+  struct SDL_Surface *backcache;               /* layers 0..COLLISION_LAYER pre-rendered, NULL if not built */
+  struct objectgrid objgrid;                   /* spatial index of objects */
+};
+
+struct levelchunkentry {
+  unsigned long offset;   /* where the chunk starts in the file */
+  unsigned long size;     /* compressed size of the chunk, in bytes */
+  unsigned int layermask; /* bit z is set if layer z is stored in the chunk */
+  unsigned int crc;       /* CRC32C of the compressed chunk */
+};
+
+/* an opened chunked level file, used for random access to its regions */
+struct levelfile {
+  int fd;
+  int width;
+  int height;
+  int chunkw;
+  int chunkh;
+  int chunkcols;   /* how many chunks per row of chunks */
+  int chunkrows;   /* how many rows of chunks */
+  struct levelchunkentry *dir;
+  unsigned long objcount;
+  unsigned long objoffset;
+  unsigned long objsize;
+  unsigned int objcrc;
+};
+
+/* computes the CRC32C (Castagnoli) of buf, using the CPU's crc32
+ * instruction when available. crc is the result of a previous call (or 0)
+ * so a checksum can be computed over several buffers. */
+unsigned int crc32c(unsigned int crc, const void *buf, long len);
+
+/* PackBits-style RLE, as used by the chunks of level files. rle_pack()
+ * needs room for len + len/128 + 1 bytes in out, and returns the packed
+ * length. rle_unpack() unpacks exactly outlen bytes, and returns how many
+ * bytes of in have been consumed, or -1 if in is corrupted. */
+long rle_pack(unsigned char *out, const unsigned char *in, long len);
+long rle_unpack(unsigned char *out, long outlen, const unsigned char *in, long inlen);
+
+/* sets the world to w x h tiles, all of them empty, with no objects. bg
+ * and backcache are left untouched. */
+void createemptyworld(struct worldstruct *world, int w, int h);
+
+/* recomputes the collision grid of the world for the given rectangle of
+ * tiles. must be called whenever the collision layer is modified. */
+void buildcollisiongrid(struct worldstruct *world, int x, int y, int w, int h);
+
+/* rebuilds the spatial index of objects. must be called whenever objects
+ * are added, removed or moved. */
+void buildobjectgrid(struct worldstruct *world);
+
+/* finds the objects overlapping the given rectangle (in tiles), in O(k)
+ * with k the number of objects living in the chunks covered by the
+ * rectangle. stores up to maxresults indexes of world->objects in result
+ * and returns how many have been found. */
+int findobjects(struct worldstruct *world, int x, int y, int w, int h, int *result, int maxresults);
+
+/* writes buff to file so that file holds either its former content or the
+ * new one, never something in between: the data goes to a temp file that
+ * is fsync()ed, then renamed over file. returns 0 on success. */
+int writefileatomic(char *file, const void *buff, long len);
+
+/* loads a level file, be it legacy or chunked. returns 0 on success. */
+int loadlevel(char *file, struct worldstruct *world);
+
+/* loads/saves a level in the legacy format. return 0 on success. saving
+ * is atomic, like savelevel(). */
+int loadlevel_legacy(char *file, struct worldstruct *world);
+int savelevel_legacy(char *file, struct worldstruct *world);
+
+/* serializes the world into a newly allocated chunked level image, and
+ * stores its length in *len. returns NULL on out of memory. */
+unsigned char *packlevel(struct worldstruct *world, long *len);
+
+/* saves the world as a chunked level file, atomically (see
+ * writefileatomic). returns 0 on success. */
+int savelevel(char *file, struct worldstruct *world);
+
+/* random access to a chunked level file: openlevel() reads the header and
+ * the chunk directory, readlevelregion() loads all chunks overlapping the
+ * given rectangle (in tiles) into world using one pread(). Both return 0 on
+ * success, -1 on I/O error or corruption. */
+int openlevel(char *file, struct levelfile *lf);
+int readlevelregion(struct levelfile *lf, struct worldstruct *world, int x, int y, int w, int h);
+void closelevel(struct levelfile *lf);
+
+/* loads the object table of an opened chunked level file into world, and
+ * rebuilds its object grid. returns 0 on success. */
+int readlevelobjects(struct levelfile *lf, struct worldstruct *world);
+
+/* checks all checksums of a chunked level file. returns the number of
+ * corrupted chunks, the object table counting as one (so 0 if all is
+ * fine), or -1 if the file cannot be read or its header/directory is
+ * damaged. */
+int verifylevel(char *file);
+
+#endif
@@ -0,0 +1,379 @@
+/* level manager for Mike O'Possum */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), free() */
+#include <string.h>         /* strcmp(), strncpy() */
+#include <pthread.h>
+#include <SDL/SDL.h>
+
+#include "level.h"
+#include "levelmgr.h"
+#include "filewatch.h"
+#include "registry.h"
+
+
+/* reads the pixel at (x,y) of a 32 bits surface */
+#define GETPIXEL32(s, x, y) (((Uint32 *)((Uint8 *)(s)->pixels + (y) * (s)->pitch))[x])
+
+
+/* composes a tile over the (x,y) pixel position of dst, using the alpha
+ * channel of the tile. both surfaces must be 32 bits. */
+static void composetile(SDL_Surface *dst, int x, int y, SDL_Surface *tile) {
+  SDL_PixelFormat *sf = tile->format, *df = dst->format;
+  Uint32 s, d;
+  unsigned int a, r, g, b;
+  int i, j;
+  for (j = 0; j < tile->h; j++) {
+    if (y + j >= dst->h) break;
+    for (i = 0; i < tile->w; i++) {
+      if (x + i >= dst->w) break;
+      s = GETPIXEL32(tile, i, j);
+      a = 255;
+      if (sf->Amask != 0) a = ((s & sf->Amask) >> sf->Ashift) << sf->Aloss;
+      if (a == 0) continue;
+      r = ((s & sf->Rmask) >> sf->Rshift) << sf->Rloss;
+      g = ((s & sf->Gmask) >> sf->Gshift) << sf->Gloss;
+      b = ((s & sf->Bmask) >> sf->Bshift) << sf->Bloss;
+      if (a < 255) {
+        d = GETPIXEL32(dst, x + i, y + j);
+        r = (r * a + ((((d & df->Rmask) >> df->Rshift) << df->Rloss) * (255 - a))) / 255;
+        g = (g * a + ((((d & df->Gmask) >> df->Gshift) << df->Gloss) * (255 - a))) / 255;
+        b = (b * a + ((((d & df->Bmask) >> df->Bshift) << df->Bloss) * (255 - a))) / 255;
+      }
+      GETPIXEL32(dst, x + i, y + j) = ((r >> df->Rloss) << df->Rshift) | ((g >> df->Gloss) << df->Gshift) | ((b >> df->Bloss) << df->Bshift);
+    }
+  }
+}
+
+
+int buildrendercache(struct worldstruct *world, SDL_Surface **tiles, int tilescount, SDL_PixelFormat *format, int x, int y, int w, int h) {
+  SDL_Surface *cache = world->backcache;
+  int i, j, z, t, tw = tiles[0]->w, th = tiles[0]->h;
+  if (format->BytesPerPixel != 4) return(-1); /* only 32 bits screens are supported */
+  if (cache == NULL) {
+    cache = SDL_CreateRGBSurface(SDL_SWSURFACE, WORLD_MAXW * tw, WORLD_MAXH * th, 32, format->Rmask, format->Gmask, format->Bmask, 0);
+    if (cache == NULL) return(-1);
+    registry_addsurface(cache, "render cache", "levelmgr");
+    world->backcache = cache;
+    x = 0;
+    y = 0;
+    w = WORLD_MAXW;
+    h = WORLD_MAXH;
+  }
+  for (i = x; (i < x + w) && (i < WORLD_MAXW); i++) {
+    if (i < 0) continue;
+    for (j = y; (j < y + h) && (j < WORLD_MAXH); j++) {
+      int px = i * tw, py = cache->h - ((j + 1) * th), row;
+      if (j < 0) continue;
+      /* the cache is opaque, start from black just like drawscreen() does */
+      for (row = 0; row < th; row++) memset((Uint8 *)cache->pixels + ((py + row) * cache->pitch) + (px * 4), 0, tw * 4);
+      for (z = 0; z <= COLLISION_LAYER; z++) {
+        t = world->tilemap[i][j][z];
+        if ((t > 0) && (t < tilescount) && (tiles[t]->format->BytesPerPixel == 4)) composetile(cache, px, py, tiles[t]);
+      }
+    }
+  }
+  return(0);
+}
+
+
+static void freeworld(struct worldstruct *world) {
+  if (world == NULL) return;
+  if (world->backcache != NULL) registry_freesurface(world->backcache);
+  free(world);
+}
+
+
+static void *levelmgr_worker(void *arg) {
+  struct levelmgr *mgr = arg;
+  struct worldstruct *world;
+  char file[256];
+  int i, res;
+  pthread_mutex_lock(&mgr->lock);
+  for (;;) {
+    for (i = 0; i < LEVELMGR_SLOTS; i++) if (mgr->slot[i].state == SLOT_QUEUED) break;
+    if (i == LEVELMGR_SLOTS) { /* nothing to do */
+      if (mgr->quit != 0) break;
+      pthread_cond_wait(&mgr->cond, &mgr->lock);
+      continue;
+    }
+    mgr->slot[i].state = SLOT_LOADING;
+    strcpy(file, mgr->slot[i].file);
+    pthread_mutex_unlock(&mgr->lock);
+
+    /* decode the level and prebuild its caches, without holding the lock */
+    res = -1;
+    world = malloc(sizeof(struct worldstruct));
+    if (world != NULL) {
+      world->bg = NULL;
+      world->backcache = NULL;
+      res = loadlevel(file, world);
+    }
+    if (res == 0) {
+        buildrendercache(world, mgr->tiles, mgr->tilescount, mgr->format, 0, 0, WORLD_MAXW, WORLD_MAXH);
+      } else {
+        printf("failed to load level '%s'\n", file);
+        freeworld(world);
+        world = NULL;
+    }
+
+    pthread_mutex_lock(&mgr->lock);
+    mgr->slot[i].world = world;
+    mgr->slot[i].state = (world != NULL) ? SLOT_READY : SLOT_FAILED;
+    pthread_cond_broadcast(&mgr->cond);
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  return(NULL);
+}
+
+
+/* called from the file watcher thread whenever a level file is rewritten */
+static void levelmgr_filechanged(char *file, void *userdata) {
+  struct levelmgr *mgr = userdata;
+  struct worldstruct *fresh;
+  struct levelslot *slot;
+  int i, x, y, z, n, objchanged;
+  fresh = malloc(sizeof(struct worldstruct));
+  if (fresh == NULL) return;
+  if (loadlevel(file, fresh) != 0) { /* probably not fully written yet, another event will follow */
+    free(fresh);
+    return;
+  }
+  pthread_mutex_lock(&mgr->lock);
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    slot = &mgr->slot[i];
+    if ((slot->state != SLOT_READY) || (strcmp(slot->file, file) != 0)) continue;
+    /* the world in memory is only modified by levelmgr_applyreload() under
+     * the lock, so it is safe to compare against it here. a pending diff
+     * is simply replaced, since it was computed against the same world. */
+    free(slot->diff);
+    free(slot->diffobjects);
+    slot->diff = NULL;
+    slot->diffcount = 0;
+    slot->diffobjects = NULL;
+    n = 0;
+    for (x = 0; x < WORLD_MAXW; x++) {
+      for (y = 0; y < WORLD_MAXH; y++) {
+        for (z = 0; z < WORLD_LAYERS; z++) if (fresh->tilemap[x][y][z] != slot->world->tilemap[x][y][z]) n++;
+      }
+    }
+    objchanged = (fresh->objectcount != slot->world->objectcount) || (memcmp(fresh->objects, slot->world->objects, fresh->objectcount * sizeof(struct levelobject)) != 0);
+    if ((n == 0) && (objchanged == 0) && (fresh->width == slot->world->width) && (fresh->height == slot->world->height)) continue;
+    if (objchanged != 0) {
+      slot->diffobjects = malloc((fresh->objectcount + 1) * sizeof(struct levelobject));
+      if (slot->diffobjects == NULL) continue;
+      memcpy(slot->diffobjects, fresh->objects, fresh->objectcount * sizeof(struct levelobject));
+      slot->diffobjectcount = fresh->objectcount;
+    }
+    slot->diff = malloc((n + 1) * sizeof(struct celldiff));
+    if (slot->diff == NULL) {
+      free(slot->diffobjects);
+      slot->diffobjects = NULL;
+      continue;
+    }
+    for (x = 0; x < WORLD_MAXW; x++) {
+      for (y = 0; y < WORLD_MAXH; y++) {
+        for (z = 0; z < WORLD_LAYERS; z++) {
+          if (fresh->tilemap[x][y][z] == slot->world->tilemap[x][y][z]) continue;
+          slot->diff[slot->diffcount].x = x;
+          slot->diff[slot->diffcount].y = y;
+          slot->diff[slot->diffcount].z = z;
+          slot->diff[slot->diffcount].tile = fresh->tilemap[x][y][z];
+          slot->diffcount++;
+        }
+      }
+    }
+    slot->diffwidth = fresh->width;
+    slot->diffheight = fresh->height;
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  free(fresh);
+}
+
+
+int levelmgr_init(struct levelmgr *mgr, SDL_Surface **tiles, int tilescount, SDL_PixelFormat *format) {
+  memset(mgr->slot, 0, sizeof(mgr->slot));
+  mgr->tiles = tiles;
+  mgr->tilescount = tilescount;
+  mgr->format = format;
+  mgr->quit = 0;
+  mgr->watch = NULL;
+  pthread_mutex_init(&mgr->lock, NULL);
+  pthread_cond_init(&mgr->cond, NULL);
+  if (pthread_create(&mgr->thread, NULL, levelmgr_worker, mgr) != 0) return(-1);
+  return(0);
+}
+
+
+/* returns the slot of a level (queuing it if unknown), or NULL if no slot
+ * is free. must be called with the lock held. */
+static struct levelslot *levelmgr_findslot(struct levelmgr *mgr, char *file) {
+  int i;
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    if ((mgr->slot[i].state != SLOT_EMPTY) && (strcmp(mgr->slot[i].file, file) == 0)) return(&mgr->slot[i]);
+  }
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    if (mgr->slot[i].state == SLOT_EMPTY) {
+      strncpy(mgr->slot[i].file, file, sizeof(mgr->slot[i].file) - 1);
+      mgr->slot[i].file[sizeof(mgr->slot[i].file) - 1] = 0;
+      mgr->slot[i].state = SLOT_QUEUED;
+      mgr->slot[i].inuse = 0;
+      mgr->slot[i].world = NULL;
+      mgr->slot[i].diff = NULL;
+      mgr->slot[i].diffcount = 0;
+      mgr->slot[i].diffobjects = NULL;
+      pthread_cond_broadcast(&mgr->cond);
+      return(&mgr->slot[i]);
+    }
+  }
+  return(NULL);
+}
+
+
+int levelmgr_preload(struct levelmgr *mgr, char *file) {
+  struct levelslot *slot;
+  pthread_mutex_lock(&mgr->lock);
+  slot = levelmgr_findslot(mgr, file);
+  pthread_mutex_unlock(&mgr->lock);
+  if (slot == NULL) return(-1);
+  return(0);
+}
+
+
+struct worldstruct *levelmgr_get(struct levelmgr *mgr, char *file) {
+  struct levelslot *slot;
+  struct worldstruct *world = NULL;
+  pthread_mutex_lock(&mgr->lock);
+  slot = levelmgr_findslot(mgr, file);
+  if (slot != NULL) {
+    while ((slot->state == SLOT_QUEUED) || (slot->state == SLOT_LOADING)) pthread_cond_wait(&mgr->cond, &mgr->lock);
+    if (slot->state == SLOT_READY) {
+        world = slot->world;
+        slot->inuse = 1;
+        if (mgr->watch != NULL) filewatch_add(mgr->watch, slot->file, levelmgr_filechanged, mgr);
+      } else { /* forget about failed loads, so they can be retried later */
+        slot->state = SLOT_EMPTY;
+    }
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  return(world);
+}
+
+
+void levelmgr_release(struct levelmgr *mgr, struct worldstruct *world) {
+  int i;
+  pthread_mutex_lock(&mgr->lock);
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    if ((mgr->slot[i].state == SLOT_READY) && (mgr->slot[i].world == world)) {
+      mgr->slot[i].state = SLOT_EMPTY;
+      mgr->slot[i].world = NULL;
+      mgr->slot[i].inuse = 0;
+      free(mgr->slot[i].diff);
+      free(mgr->slot[i].diffobjects);
+      mgr->slot[i].diff = NULL;
+      mgr->slot[i].diffobjects = NULL;
+      mgr->slot[i].diffcount = 0;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  if (i < LEVELMGR_SLOTS) freeworld(world);
+}
+
+
+int levelmgr_hotreload(struct levelmgr *mgr) {
+  int i;
+  if (mgr->watch != NULL) return(0);
+  mgr->watch = filewatch_start();
+  if (mgr->watch == NULL) return(-1);
+  pthread_mutex_lock(&mgr->lock);
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    if ((mgr->slot[i].state == SLOT_READY) && (mgr->slot[i].inuse != 0)) filewatch_add(mgr->watch, mgr->slot[i].file, levelmgr_filechanged, mgr);
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  return(0);
+}
+
+
+int levelmgr_applyreload(struct levelmgr *mgr, struct worldstruct *world, levelmgr_callback callback, void *userdata) {
+  struct celldiff *diff = NULL;
+  struct levelobject *objects = NULL;
+  int i, n, count = 0;
+  pthread_mutex_lock(&mgr->lock);
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    if ((mgr->slot[i].world != world) || (mgr->slot[i].diff == NULL)) continue;
+    diff = mgr->slot[i].diff;
+    count = mgr->slot[i].diffcount;
+    objects = mgr->slot[i].diffobjects;
+    mgr->slot[i].diff = NULL;
+    mgr->slot[i].diffcount = 0;
+    mgr->slot[i].diffobjects = NULL;
+    /* patch the world while still holding the lock, so the watcher thread
+     * never diffs against a half-updated world */
+    world->width = mgr->slot[i].diffwidth;
+    world->height = mgr->slot[i].diffheight;
+    for (n = 0; n < count; n++) {
+      world->tilemap[diff[n].x][diff[n].y][diff[n].z] = diff[n].tile;
+      if (diff[n].z == COLLISION_LAYER) buildcollisiongrid(world, diff[n].x, diff[n].y, 1, 1);
+      if ((diff[n].z <= COLLISION_LAYER) && (world->backcache != NULL)) buildrendercache(world, mgr->tiles, mgr->tilescount, mgr->format, diff[n].x, diff[n].y, 1, 1);
+      if (callback != NULL) callback(world, diff[n].x, diff[n].y, userdata);
+    }
+    if (objects != NULL) {
+      memcpy(world->objects, objects, mgr->slot[i].diffobjectcount * sizeof(struct levelobject));
+      world->objectcount = mgr->slot[i].diffobjectcount;
+      buildobjectgrid(world);
+      count++;
+    }
+    break;
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  free(diff);
+  free(objects);
+  return(count);
+}
+
+
+int levelmgr_retile(struct levelmgr *mgr, levelmgr_tilescallback change, void *userdata) {
+  int i, changed;
+  pthread_mutex_lock(&mgr->lock);
+  /* levels are decoded without the lock held, with the tiles in use */
+  for (;;) {
+    for (i = 0; i < LEVELMGR_SLOTS; i++) if (mgr->slot[i].state == SLOT_LOADING) break;
+    if (i == LEVELMGR_SLOTS) break;
+    pthread_cond_wait(&mgr->cond, &mgr->lock);
+  }
+  changed = change(userdata);
+  if (changed > 0) {
+    for (i = 0; i < LEVELMGR_SLOTS; i++) {
+      if ((mgr->slot[i].state == SLOT_READY) && (mgr->slot[i].world->backcache != NULL)) buildrendercache(mgr->slot[i].world, mgr->tiles, mgr->tilescount, mgr->format, 0, 0, WORLD_MAXW, WORLD_MAXH);
+    }
+  }
+  pthread_mutex_unlock(&mgr->lock);
+  return(changed);
+}
+
+
+void levelmgr_shutdown(struct levelmgr *mgr) {
+  int i;
+  filewatch_stop(mgr->watch);
+  mgr->watch = NULL;
+  pthread_mutex_lock(&mgr->lock);
+  mgr->quit = 1;
+  for (i = 0; i < LEVELMGR_SLOTS; i++) { /* drop all pending work */
+    if (mgr->slot[i].state == SLOT_QUEUED) mgr->slot[i].state = SLOT_EMPTY;
+  }
+  pthread_cond_broadcast(&mgr->cond);
+  pthread_mutex_unlock(&mgr->lock);
+  pthread_join(mgr->thread, NULL);
+  for (i = 0; i < LEVELMGR_SLOTS; i++) {
+    freeworld(mgr->slot[i].world);
+    free(mgr->slot[i].diff);
+    free(mgr->slot[i].diffobjects);
+    mgr->slot[i].diff = NULL;
+    mgr->slot[i].diffobjects = NULL;
+    mgr->slot[i].world = NULL;
+    mgr->slot[i].state = SLOT_EMPTY;
+  }
+  pthread_mutex_destroy(&mgr->lock);
+  pthread_cond_destroy(&mgr->cond);
+}
@@ -0,0 +1,115 @@
+/* level manager for Mike O'Possum
+ *
+ * Holds several worlds at once. Levels are decoded by a background thread,
+ * along with their collision grid and the pre-rendered cache of their
+ * background layers, so the game can switch to the next level by simply
+ * swapping a pointer.
+ *
+ * With hot reload enabled, level files are watched: when one is rewritten
+ * it is parsed again in background and diffed against the world in memory,
+ * the game then applies only the changed cells between two frames. */
+
+#ifndef LEVELMGR_H_SENTINEL
+#define LEVELMGR_H_SENTINEL
+
+#include <pthread.h>
+#include <SDL/SDL.h>
+
+#include "level.h"
+#include "filewatch.h"
+
+#define LEVELMGR_SLOTS 4
+
+enum slotstate {
+  SLOT_EMPTY = 0,
+  SLOT_QUEUED,    /* waiting for the worker thread */
+  SLOT_LOADING,   /* being decoded by the worker thread */
+  SLOT_READY,
+  SLOT_FAILED
+};
+
+/* a cell that changed in a level file since it has been loaded */
+struct celldiff {
+  unsigned short x;
+  unsigned short y;
+  unsigned char z;
+  unsigned char tile;
+};
+
+struct levelslot {
+  char file[256];
+  enum slotstate state;
+  int inuse;      /* handed out to the game by levelmgr_get() */
+  struct worldstruct *world;
+  /* pending hot reload, waiting for levelmgr_applyreload() */
+  struct celldiff *diff;
+  int diffcount;
+  int diffwidth;
+  int diffheight;
+  struct levelobject *diffobjects; /* new set of objects, NULL if unchanged */
+  int diffobjectcount;
+};
+
+struct levelmgr {
+  struct levelslot slot[LEVELMGR_SLOTS];
+  SDL_Surface **tiles;
+  int tilescount;
+  SDL_PixelFormat *format; /* pixel format of the render caches */
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  int quit;
+  struct filewatch *watch; /* non-NULL if hot reload is enabled */
+};
+
+/* (re)renders the background layers of the given rectangle of tiles into
+ * the render cache of the world, allocating the cache if needed. Does not
+ * use SDL blits, so it is safe to call from another thread than the one
+ * drawing the screen. returns 0 on success. */
+int buildrendercache(struct worldstruct *world, SDL_Surface **tiles, int tilescount, SDL_PixelFormat *format, int x, int y, int w, int h);
+
+/* starts the manager and its worker thread. render caches will be built
+ * using the given tiles, in the given pixel format (the screen's one). */
+int levelmgr_init(struct levelmgr *mgr, SDL_Surface **tiles, int tilescount, SDL_PixelFormat *format);
+
+/* asks the worker thread to decode a level in the background. returns 0 if
+ * the level has been queued (or is already known), -1 if no slot is free. */
+int levelmgr_preload(struct levelmgr *mgr, char *file);
+
+/* returns the world of a level, waiting for it to be decoded if needed
+ * (which is not the case if it has been preloaded early enough). returns
+ * NULL if the level could not be loaded. */
+struct worldstruct *levelmgr_get(struct levelmgr *mgr, char *file);
+
+/* gives back a world obtained from levelmgr_get(), freeing its slot */
+void levelmgr_release(struct levelmgr *mgr, struct worldstruct *world);
+
+/* starts watching the files of all levels handed out by levelmgr_get(),
+ * now and later. returns 0 on success. */
+int levelmgr_hotreload(struct levelmgr *mgr);
+
+/* called by levelmgr_applyreload() for every changed cell, with the manager
+ * locked */
+typedef void (*levelmgr_callback)(struct worldstruct *world, int x, int y, void *userdata);
+
+/* called by levelmgr_retile() to change the tiles, with the manager
+ * locked. returns the number of changes. */
+typedef int (*levelmgr_tilescallback)(void *userdata);
+
+/* calls back for the tiles to be changed (their pointers, in the array
+ * given to levelmgr_init()) at a time the worker thread doesn't use them,
+ * waiting for it to finish the level it may be decoding. if anything
+ * changed, the render caches of all loaded levels are built again with
+ * the new tiles. returns what the callback returned. */
+int levelmgr_retile(struct levelmgr *mgr, levelmgr_tilescallback change, void *userdata);
+
+/* applies to the world the cells changed by a reload of its file, if any,
+ * updating its collision grid and render cache for these cells only, and
+ * calling back for each of them (callback may be NULL). meant to be called
+ * between two frames. returns the number of changed cells. */
+int levelmgr_applyreload(struct levelmgr *mgr, struct worldstruct *world, levelmgr_callback callback, void *userdata);
+
+/* stops the worker thread and frees all worlds */
+void levelmgr_shutdown(struct levelmgr *mgr);
+
+#endif
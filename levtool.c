@@ -0,0 +1,383 @@
+/* headless batch tool for Mike O'Possum level files
+ *
+ * Works on level files and whole directories of them (all the .dat files
+ * they contain, recursively), several files at once, without any display:
+ *
+ *   levtool [-j jobs] validate path...   checks headers, sizes and checksums
+ *   levtool [-j jobs] stats path...      per-layer tile histograms and bounding boxes
+ *   levtool [-j jobs] compress path...   rewrites levels as chunked (compressed) files
+ *   levtool [-j jobs] convert legacy|chunked path...
+ *
+ * Reports are printed in the order of the files, whatever order they have
+ * been processed in. The exit code is 0 only if all files went fine. */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), realloc(), free(), qsort() */
+#include <string.h>         /* strcmp(), strlen() */
+#include <stdarg.h>         /* va_list */
+#include <unistd.h>         /* sysconf() */
+#include <dirent.h>         /* opendir() */
+#include <pthread.h>
+#include <sys/stat.h>       /* stat() */
+
+#include "level.h"
+
+#define LEVTOOL_MAXTHREADS 64
+#define LEVTOOL_TILES 64    /* how many tiles the tileset has */
+
+enum command {
+  CMD_VALIDATE,
+  CMD_STATS,
+  CMD_COMPRESS,
+  CMD_CONVERT
+};
+
+enum levelformat {
+  FORMAT_NONE = 0,          /* not readable */
+  FORMAT_LEGACY,
+  FORMAT_CHUNKED
+};
+
+/* one file to process, and what came out of it */
+struct job {
+  char *file;
+  char *report;
+  long reportlen;
+  long reportsize;
+  int failed;
+};
+
+struct batch {
+  enum command command;
+  enum levelformat target;  /* for CMD_CONVERT */
+  struct job *job;
+  int count;
+  int next;                 /* next job to be picked by a thread */
+  pthread_mutex_t lock;
+};
+
+
+/* appends a line to the report of a job */
+static void report(struct job *job, char *fmt, ...) {
+  va_list ap;
+  char *newreport;
+  long len;
+  va_start(ap, fmt);
+  len = vsnprintf(NULL, 0, fmt, ap);
+  va_end(ap);
+  if (job->reportlen + len + 1 > job->reportsize) {
+    newreport = realloc(job->report, job->reportlen + len + 256);
+    if (newreport == NULL) return;
+    job->report = newreport;
+    job->reportsize = job->reportlen + len + 256;
+  }
+  va_start(ap, fmt);
+  vsnprintf(job->report + job->reportlen, len + 1, fmt, ap);
+  va_end(ap);
+  job->reportlen += len;
+}
+
+
+/* finds out the format of a level file from its first bytes, and its size */
+static enum levelformat fileformat(char *file, long *size, int *version) {
+  FILE *fd;
+  unsigned char buff[6];
+  enum levelformat res = FORMAT_LEGACY;
+  fd = fopen(file, "rb");
+  if (fd == NULL) return(FORMAT_NONE);
+  fseek(fd, 0, SEEK_END);
+  *size = ftell(fd);
+  fseek(fd, 0, SEEK_SET);
+  *version = 0;
+  if (fread(buff, 6, 1, fd) == 1) {
+    if (memcmp(buff, LEVEL_MAGIC, 4) == 0) {
+      res = FORMAT_CHUNKED;
+      *version = (buff[4] << 8) | buff[5];
+    }
+  }
+  fclose(fd);
+  return(res);
+}
+
+
+/* checks what loadlevel() does not: the file size of legacy levels, the
+ * checksums of chunked ones, and that the content makes sense. returns the
+ * number of problems found. */
+static int validate(struct job *job, struct worldstruct *world, enum levelformat format, long size) {
+  int problems = 0, bad, x, y, z, i;
+  if (format == FORMAT_LEGACY) {
+      if (size != 4 + (long)world->width * world->height * WORLD_LAYERS) {
+        report(job, "  file is %ld bytes long, %ld expected for %dx%d tiles\n", size, 4 + (long)world->width * world->height * WORLD_LAYERS, world->width, world->height);
+        problems++;
+      }
+    } else {
+      bad = verifylevel(job->file);
+      if (bad != 0) {
+        report(job, "  %d corrupted chunk(s)\n", bad);
+        problems++;
+      }
+  }
+  if ((world->width <= 0) || (world->height <= 0)) {
+    report(job, "  empty world (%dx%d tiles)\n", world->width, world->height);
+    problems++;
+  }
+  for (x = 0; x < world->width; x++) {
+    for (y = 0; y < world->height; y++) {
+      for (z = 0; z < WORLD_LAYERS; z++) {
+        if (world->tilemap[x][y][z] < LEVTOOL_TILES) continue;
+        report(job, "  unknown tile %d at (%d,%d) on layer %d\n", world->tilemap[x][y][z], x, y, z);
+        problems++;
+      }
+    }
+  }
+  for (i = 0; i < world->objectcount; i++) {
+    struct levelobject *obj = &(world->objects[i]);
+    if ((obj->x + obj->w <= world->width) && (obj->y + obj->h <= world->height)) continue;
+    report(job, "  object %d (type %d) at (%d,%d) is out of the world\n", i, obj->type, obj->x, obj->y);
+    problems++;
+  }
+  return(problems);
+}
+
+
+/* prints the number of cells using each tile, and the bounding box of the
+ * non-empty cells, for each layer */
+static void stats(struct job *job, struct worldstruct *world) {
+  long histogram[256];
+  int x, y, z, t, minx, miny, maxx, maxy;
+  long cells;
+  for (z = 0; z < WORLD_LAYERS; z++) {
+    memset(histogram, 0, sizeof(histogram));
+    minx = world->width;
+    miny = world->height;
+    maxx = -1;
+    maxy = -1;
+    for (x = 0; x < world->width; x++) {
+      for (y = 0; y < world->height; y++) {
+        t = world->tilemap[x][y][z] & 0xFF;
+        histogram[t]++;
+        if (t == 0) continue;
+        if (x < minx) minx = x;
+        if (y < miny) miny = y;
+        if (x > maxx) maxx = x;
+        if (y > maxy) maxy = y;
+      }
+    }
+    cells = (long)world->width * world->height - histogram[0];
+    if (cells == 0) {
+      report(job, "  layer %d: empty\n", z);
+      continue;
+    }
+    report(job, "  layer %d: %ld tiles, bounding box (%d,%d)-(%d,%d)\n   ", z, cells, minx, miny, maxx, maxy);
+    for (t = 1; t < 256; t++) {
+      if (histogram[t] != 0) report(job, " %d:%ld", t, histogram[t]);
+    }
+    report(job, "\n");
+  }
+}
+
+
+/* processes one level file */
+static void processfile(struct batch *batch, struct job *job) {
+  struct worldstruct *world;
+  enum levelformat format, target;
+  long size, newsize;
+  int version, res;
+  unsigned char *image;
+  format = fileformat(job->file, &size, &version);
+  world = malloc(sizeof(struct worldstruct));
+  if ((format == FORMAT_NONE) || (world == NULL) || (loadlevel(job->file, world) != 0)) {
+    report(job, "%s: cannot be loaded\n", job->file);
+    job->failed = 1;
+    free(world);
+    return;
+  }
+  if (format == FORMAT_LEGACY) {
+      report(job, "%s: legacy, %dx%d tiles, %ld bytes\n", job->file, world->width, world->height, size);
+    } else {
+      report(job, "%s: chunked v%d, %dx%d tiles, %d objects, %ld bytes\n", job->file, version, world->width, world->height, world->objectcount, size);
+  }
+  switch (batch->command) {
+    case CMD_VALIDATE:
+      if (validate(job, world, format, size) != 0) job->failed = 1;
+      break;
+    case CMD_STATS:
+      stats(job, world);
+      break;
+    case CMD_COMPRESS:
+    case CMD_CONVERT:
+      target = (batch->command == CMD_COMPRESS) ? FORMAT_CHUNKED : batch->target;
+      if ((target == FORMAT_LEGACY) && (world->objectcount > 0)) {
+          report(job, "  has objects, which the legacy format cannot store: left as is\n");
+          job->failed = 1;
+          break;
+        } else if (target == FORMAT_LEGACY) {
+          if (format == FORMAT_LEGACY) break;
+          res = savelevel_legacy(job->file, world);
+          newsize = 4 + (long)world->width * world->height * WORLD_LAYERS;
+        } else {
+          image = packlevel(world, &newsize);
+          res = -1;
+          /* rewrite the file only if its content changes */
+          if ((image != NULL) && ((format == FORMAT_LEGACY) || (newsize != size) || (version != LEVEL_VERSION))) {
+              res = writefileatomic(job->file, image, newsize);
+            } else if (image != NULL) {
+              res = 0;
+          }
+          free(image);
+      }
+      if (res != 0) {
+          report(job, "  failed to write the file\n");
+          job->failed = 1;
+        } else {
+          report(job, "  -> %s, %ld bytes (%ld%%)\n", (target == FORMAT_LEGACY) ? "legacy" : "chunked", newsize, (size > 0) ? (newsize * 100) / size : 100);
+      }
+      break;
+  }
+  free(world);
+}
+
+
+static void *worker(void *arg) {
+  struct batch *batch = arg;
+  int i;
+  for (;;) {
+    pthread_mutex_lock(&batch->lock);
+    i = batch->next++;
+    pthread_mutex_unlock(&batch->lock);
+    if (i >= batch->count) break;
+    processfile(batch, &(batch->job[i]));
+  }
+  return(NULL);
+}
+
+
+static int comparenames(const void *a, const void *b) {
+  return(strcmp(*(char **)a, *(char **)b));
+}
+
+
+/* adds path to the batch: the file itself, or all .dat files found in it
+ * if it is a directory. returns 0 on success. */
+static int addpath(struct batch *batch, char *path) {
+  struct stat st;
+  struct job *newjob;
+  struct dirent *entry;
+  DIR *dir;
+  char **names = NULL, **newnames;
+  int count = 0, i, len, res = 0;
+  if (stat(path, &st) != 0) {
+    printf("%s: not found\n", path);
+    return(-1);
+  }
+  if (S_ISDIR(st.st_mode) == 0) {
+    newjob = realloc(batch->job, (batch->count + 1) * sizeof(struct job));
+    if (newjob == NULL) return(-1);
+    batch->job = newjob;
+    memset(&(batch->job[batch->count]), 0, sizeof(struct job));
+    batch->job[batch->count].file = malloc(strlen(path) + 1);
+    if (batch->job[batch->count].file == NULL) return(-1);
+    strcpy(batch->job[batch->count].file, path);
+    batch->count++;
+    return(0);
+  }
+  /* a directory: its subdirectories and .dat files, sorted by name */
+  dir = opendir(path);
+  if (dir == NULL) return(-1);
+  while ((entry = readdir(dir)) != NULL) {
+    if (entry->d_name[0] == '.') continue;
+    len = strlen(path) + strlen(entry->d_name) + 2;
+    newnames = realloc(names, (count + 1) * sizeof(char *));
+    if (newnames == NULL) break;
+    names = newnames;
+    names[count] = malloc(len);
+    if (names[count] == NULL) break;
+    sprintf(names[count], "%s/%s", path, entry->d_name);
+    if ((stat(names[count], &st) != 0) || ((S_ISDIR(st.st_mode) == 0) && ((strlen(entry->d_name) < 4) || (strcmp(entry->d_name + strlen(entry->d_name) - 4, ".dat") != 0)))) {
+      free(names[count]);
+      continue;
+    }
+    count++;
+  }
+  closedir(dir);
+  if (count > 0) qsort(names, count, sizeof(char *), comparenames);
+  for (i = 0; i < count; i++) {
+    if (addpath(batch, names[i]) != 0) res = -1;
+    free(names[i]);
+  }
+  free(names);
+  return(res);
+}
+
+
+static void usage(void) {
+  printf("Usage: levtool [-j jobs] validate|stats|compress path...\n"
+         "       levtool [-j jobs] convert legacy|chunked path...\n"
+         "paths may be level files or directories, searched for .dat files\n");
+}
+
+
+int main(int argc, char **argv) {
+  struct batch batch;
+  pthread_t thread[LEVTOOL_MAXTHREADS];
+  int threads, started, i, failed = 0;
+
+  memset(&batch, 0, sizeof(batch));
+  threads = sysconf(_SC_NPROCESSORS_ONLN);
+  argv++;
+  argc--;
+  if ((argc >= 2) && (strcmp(argv[0], "-j") == 0)) {
+    threads = atoi(argv[1]);
+    argv += 2;
+    argc -= 2;
+  }
+  if (threads < 1) threads = 1;
+  if (threads > LEVTOOL_MAXTHREADS) threads = LEVTOOL_MAXTHREADS;
+
+  if (argc < 2) {
+    usage();
+    return(1);
+  }
+  if (strcmp(argv[0], "validate") == 0) {
+      batch.command = CMD_VALIDATE;
+    } else if (strcmp(argv[0], "stats") == 0) {
+      batch.command = CMD_STATS;
+    } else if (strcmp(argv[0], "compress") == 0) {
+      batch.command = CMD_COMPRESS;
+    } else if ((strcmp(argv[0], "convert") == 0) && (argc >= 3) && (strcmp(argv[1], "legacy") == 0)) {
+      batch.command = CMD_CONVERT;
+      batch.target = FORMAT_LEGACY;
+      argv++;
+      argc--;
+    } else if ((strcmp(argv[0], "convert") == 0) && (argc >= 3) && (strcmp(argv[1], "chunked") == 0)) {
+      batch.command = CMD_CONVERT;
+      batch.target = FORMAT_CHUNKED;
+      argv++;
+      argc--;
+    } else {
+      usage();
+      return(1);
+  }
+  for (i = 1; i < argc; i++) {
+    if (addpath(&batch, argv[i]) != 0) failed = 1;
+  }
+
+  /* process all files in parallel, then print the reports in order */
+  pthread_mutex_init(&batch.lock, NULL);
+  if (threads > batch.count) threads = batch.count;
+  for (started = 0; started < threads; started++) {
+    if (pthread_create(&thread[started], NULL, worker, &batch) != 0) break;
+  }
+  if (started == 0) worker(&batch); /* no thread at all, do it ourselves */
+  for (i = 0; i < started; i++) pthread_join(thread[i], NULL);
+  pthread_mutex_destroy(&batch.lock);
+
+  for (i = 0; i < batch.count; i++) {
+    if (batch.job[i].report != NULL) fputs(batch.job[i].report, stdout);
+    if (batch.job[i].failed != 0) failed = 1;
+    free(batch.job[i].report);
+    free(batch.job[i].file);
+  }
+  free(batch.job);
+  return(failed);
+}
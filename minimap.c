@@ -0,0 +1,140 @@
+/* minimap of Mike O'Possum levels */
+
+#include <string.h>         /* memset() */
+#include <SDL/SDL.h>
+
+#include "level.h"
+#include "minimap.h"
+#include "registry.h"
+
+
+/* computes the average color of a tile, its colors being weighted by their
+ * alpha so that transparent pixels don't count */
+static void averagecolor(SDL_Surface *tile, unsigned char *color) {
+  unsigned long sum[4];
+  Uint8 r, g, b, a;
+  Uint32 *row;
+  int x, y;
+  memset(sum, 0, sizeof(sum));
+  SDL_LockSurface(tile);
+  for (y = 0; y < tile->h; y++) {
+    row = (Uint32 *)((Uint8 *)tile->pixels + y * tile->pitch);
+    for (x = 0; x < tile->w; x++) {
+      SDL_GetRGBA(row[x], tile->format, &r, &g, &b, &a);
+      sum[0] += r * a;
+      sum[1] += g * a;
+      sum[2] += b * a;
+      sum[3] += a;
+    }
+  }
+  SDL_UnlockSurface(tile);
+  memset(color, 0, 4);
+  if (sum[3] == 0) return;
+  color[0] = sum[0] / sum[3];
+  color[1] = sum[1] / sum[3];
+  color[2] = sum[2] / sum[3];
+  color[3] = sum[3] / (tile->w * tile->h);
+}
+
+
+int minimap_init(struct minimap *mm, SDL_Surface **tiles, int tilescount, SDL_PixelFormat *format, int scale) {
+  int i;
+  if (tilescount > 64) tilescount = 64;
+  mm->scale = scale;
+  mm->tilescount = tilescount;
+  for (i = 0; i < tilescount; i++) averagecolor(tiles[i], mm->color[i]);
+  mm->surface = SDL_CreateRGBSurface(SDL_SWSURFACE, WORLD_MAXW * scale, WORLD_MAXH * scale, format->BitsPerPixel, format->Rmask, format->Gmask, format->Bmask, 0);
+  if (mm->surface == NULL) return(-1);
+  registry_addsurface(mm->surface, "minimap", "minimap");
+  SDL_FillRect(mm->surface, NULL, 0);
+  return(0);
+}
+
+
+void minimap_update(struct minimap *mm, struct worldstruct *world, int x, int y) {
+  SDL_Rect rect;
+  unsigned int c[3], a;
+  int z, t, i;
+  if ((mm->surface == NULL) || (x < 0) || (y < 0) || (x >= WORLD_MAXW) || (y >= WORLD_MAXH)) return;
+  /* compose the average colors of all layers over black, like the game does */
+  c[0] = 0;
+  c[1] = 0;
+  c[2] = 0;
+  for (z = 0; z < WORLD_LAYERS; z++) {
+    t = world->tilemap[x][y][z];
+    if ((t <= 0) || (t >= mm->tilescount)) continue;
+    a = mm->color[t][3];
+    for (i = 0; i < 3; i++) c[i] = (c[i] * (255 - a) + mm->color[t][i] * a) / 255;
+  }
+  rect.x = x * mm->scale;
+  rect.y = (WORLD_MAXH - 1 - y) * mm->scale;
+  rect.w = mm->scale;
+  rect.h = mm->scale;
+  SDL_FillRect(mm->surface, &rect, SDL_MapRGB(mm->surface->format, c[0], c[1], c[2]));
+}
+
+
+void minimap_build(struct minimap *mm, struct worldstruct *world) {
+  int x, y;
+  for (x = 0; x < WORLD_MAXW; x++) {
+    for (y = 0; y < WORLD_MAXH; y++) minimap_update(mm, world, x, y);
+  }
+}
+
+
+void minimap_draw(struct minimap *mm, struct worldstruct *world, SDL_Surface *screen, int sx, int sy) {
+  SDL_Rect src, dst;
+  /* only the part covered by the world */
+  src.x = 0;
+  src.y = (WORLD_MAXH - world->height) * mm->scale;
+  src.w = world->width * mm->scale;
+  src.h = world->height * mm->scale;
+  dst.x = sx;
+  dst.y = sy;
+  SDL_BlitSurface(mm->surface, &src, screen, &dst);
+}
+
+
+void minimap_frame(struct minimap *mm, struct worldstruct *world, SDL_Surface *screen, int sx, int sy, int x, int y, int w, int h, Uint32 color) {
+  SDL_Rect rect, line;
+  /* clip to the world */
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > world->width) w = world->width - x;
+  if (y + h > world->height) h = world->height - y;
+  if ((w <= 0) || (h <= 0)) return;
+  rect.x = sx + x * mm->scale;
+  rect.y = sy + (world->height - (y + h)) * mm->scale;
+  rect.w = w * mm->scale;
+  rect.h = h * mm->scale;
+  line = rect;
+  line.h = 1;
+  SDL_FillRect(screen, &line, color);
+  line.y = rect.y + rect.h - 1;
+  SDL_FillRect(screen, &line, color);
+  line = rect;
+  line.w = 1;
+  SDL_FillRect(screen, &line, color);
+  line.x = rect.x + rect.w - 1;
+  SDL_FillRect(screen, &line, color);
+}
+
+
+int minimap_cellat(struct minimap *mm, struct worldstruct *world, int sx, int sy, int px, int py, int *x, int *y) {
+  if ((px < sx) || (py < sy) || (px >= sx + world->width * mm->scale) || (py >= sy + world->height * mm->scale)) return(-1);
+  *x = (px - sx) / mm->scale;
+  *y = world->height - 1 - (py - sy) / mm->scale;
+  return(0);
+}
+
+
+void minimap_free(struct minimap *mm) {
+  if (mm->surface != NULL) registry_freesurface(mm->surface);
+  mm->surface = NULL;
+}
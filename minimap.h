@@ -0,0 +1,47 @@
+/* minimap of Mike O'Possum levels
+ *
+ * An overview of the whole world, where each tile is shown as a small
+ * square of its average color. The average color of every tile is computed
+ * once, and the minimap is kept in a surface that is updated one cell at a
+ * time as the world changes, so keeping it up to date costs O(changes). */
+
+#ifndef MINIMAP_H_SENTINEL
+#define MINIMAP_H_SENTINEL
+
+#include <SDL/SDL.h>
+
+#include "level.h"
+
+struct minimap {
+  SDL_Surface *surface;     /* WORLD_MAXW x WORLD_MAXH cells, the top row being y = WORLD_MAXH - 1 */
+  int scale;                /* size of a cell on the minimap, in pixels */
+  int tilescount;
+  unsigned char color[64][4]; /* average color of each tile: red, green, blue, alpha */
+};
+
+/* computes the average color of the tiles and allocates the minimap, with
+ * scale x scale pixels per cell, in the given pixel format. returns 0 on
+ * success. */
+int minimap_init(struct minimap *mm, SDL_Surface **tiles, int tilescount, SDL_PixelFormat *format, int scale);
+
+/* redraws the whole minimap from the world */
+void minimap_build(struct minimap *mm, struct worldstruct *world);
+
+/* redraws the cell (x,y) of the minimap, after it changed in the world.
+ * does nothing if the minimap could not be initialized. */
+void minimap_update(struct minimap *mm, struct worldstruct *world, int x, int y);
+
+/* draws the minimap of the world on screen, its top left corner at (sx,sy) */
+void minimap_draw(struct minimap *mm, struct worldstruct *world, SDL_Surface *screen, int sx, int sy);
+
+/* outlines a rectangle of w x h cells, (x,y) being its bottom left cell, on
+ * the minimap drawn at (sx,sy) */
+void minimap_frame(struct minimap *mm, struct worldstruct *world, SDL_Surface *screen, int sx, int sy, int x, int y, int w, int h, Uint32 color);
+
+/* finds the cell under the (px,py) screen position, on the minimap drawn at
+ * (sx,sy). returns 0 if it is on the minimap, -1 otherwise. */
+int minimap_cellat(struct minimap *mm, struct worldstruct *world, int sx, int sy, int px, int py, int *x, int *y);
+
+void minimap_free(struct minimap *mm);
+
+#endif
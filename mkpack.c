@@ -0,0 +1,181 @@
+/* mkpack: builds an asset pack (see assets.h) out of PNG files and pixels
+ * decoded by mkpixels -b
+ *
+ * usage: mkpack [-z] pack.pak name:file[:WxHxN]|name:mirror=source...
+ *
+ *   -z      RLE-packs the data of the assets that get smaller that way
+ *   WxHxN   the asset is a sheet of N frames of WxH pixels, side by side
+ *           on its top row. without it, the asset is a single image.
+ *   mirror=source  the asset is the source asset flipped left to right,
+ *           built when loaded: nothing but the name of the source is
+ *           stored. */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), realloc(), free() */
+#include <string.h>         /* strcmp(), strchr(), strncmp(), strdup() */
+
+#include "level.h"          /* crc32c(), rle_pack(), writefileatomic() */
+#include "assets.h"
+
+
+static void put16(unsigned char *p, unsigned int v) {
+  p[0] = (v >> 8) & 0xFF;
+  p[1] = v & 0xFF;
+}
+
+static void put32(unsigned char *p, unsigned long v) {
+  p[0] = (v >> 24) & 0xFF;
+  p[1] = (v >> 16) & 0xFF;
+  p[2] = (v >> 8) & 0xFF;
+  p[3] = v & 0xFF;
+}
+
+
+/* reads a whole file into a newly allocated buffer */
+static unsigned char *readfile(char *file, long *len) {
+  FILE *fd;
+  unsigned char *buff;
+  fd = fopen(file, "rb");
+  if (fd == NULL) return(NULL);
+  fseek(fd, 0, SEEK_END);
+  *len = ftell(fd);
+  fseek(fd, 0, SEEK_SET);
+  buff = malloc(*len + 1);
+  if ((buff != NULL) && (fread(buff, 1, *len, fd) != (size_t)*len)) {
+    free(buff);
+    buff = NULL;
+  }
+  fclose(fd);
+  return(buff);
+}
+
+
+static void usage(void) {
+  printf("Usage: mkpack [-z] pack.pak name:file[:WxHxN]|name:mirror=source...\n");
+}
+
+
+int main(int argc, char **argv) {
+  unsigned char *pack, *newpack, *data, *packed, *entry;
+  char *file, *geometry;
+  long packlen, datalen, packedlen, tocoffset;
+  unsigned int framew, frameh, framecount, flags;
+  int rle = 0, count, i;
+
+  argv++;
+  argc--;
+  if ((argc >= 1) && (strcmp(argv[0], "-z") == 0)) {
+    rle = 1;
+    argv++;
+    argc--;
+  }
+  if ((argc < 2) || (argc - 1 > 0xFFFF)) {
+    usage();
+    return(1);
+  }
+  count = argc - 1;
+
+  /* the header and the table of contents, then the data of each asset */
+  tocoffset = ASSETPACK_HEADERLEN;
+  packlen = tocoffset + count * ASSETPACK_ENTRYLEN;
+  packlen = (packlen + ASSETPACK_ALIGN - 1) / ASSETPACK_ALIGN * ASSETPACK_ALIGN;
+  pack = calloc(packlen, 1);
+  if (pack == NULL) {
+    fprintf(stderr, "mkpack: out of memory\n");
+    return(1);
+  }
+  for (i = 0; i < count; i++) {
+    /* name:file[:WxHxN] */
+    file = strchr(argv[i + 1], ':');
+    if ((file == NULL) || (file - argv[i + 1] > ASSETPACK_NAMELEN) || (file == argv[i + 1])) {
+      usage();
+      return(1);
+    }
+    *file++ = 0;
+    framew = 0;
+    frameh = 0;
+    framecount = 1;
+    flags = 0;
+    if (strncmp(file, "mirror=", 7) == 0) { /* no data but the name of the source */
+        file += 7;
+        if ((*file == 0) || (strlen(file) > ASSETPACK_NAMELEN)) {
+          usage();
+          return(1);
+        }
+        framecount = 0;
+        flags = ASSETPACK_MIRROR;
+        datalen = strlen(file);
+        data = (unsigned char *)strdup(file);
+        geometry = NULL;
+      } else {
+        geometry = strchr(file, ':');
+        data = NULL;
+    }
+    if (geometry != NULL) {
+      *geometry++ = 0;
+      if ((sscanf(geometry, "%ux%ux%u", &framew, &frameh, &framecount) != 3) || (framew == 0) || (frameh == 0) || (framecount == 0) || (framecount > ASSETS_MAXFRAMES)) {
+        fprintf(stderr, "mkpack: bad sheet geometry '%s'\n", geometry);
+        return(1);
+      }
+    }
+    if (flags == 0) data = readfile(file, &datalen);
+    if (data == NULL) {
+      fprintf(stderr, "mkpack: failed to read %s\n", file);
+      return(1);
+    }
+    packed = data;
+    packedlen = datalen;
+    if ((rle != 0) && (flags == 0)) {
+      packed = malloc(datalen + datalen / 128 + 1);
+      if (packed == NULL) {
+        fprintf(stderr, "mkpack: out of memory\n");
+        return(1);
+      }
+      packedlen = rle_pack(packed, data, datalen);
+      if (packedlen < datalen) {
+          flags |= ASSETPACK_RLE;
+        } else { /* not worth it */
+          free(packed);
+          packed = data;
+          packedlen = datalen;
+      }
+    }
+    newpack = realloc(pack, packlen + packedlen + ASSETPACK_ALIGN);
+    if (newpack == NULL) {
+      fprintf(stderr, "mkpack: out of memory\n");
+      return(1);
+    }
+    pack = newpack;
+    entry = pack + tocoffset + i * ASSETPACK_ENTRYLEN;
+    memset(entry, 0, ASSETPACK_NAMELEN);
+    memcpy(entry, argv[i + 1], strlen(argv[i + 1]));
+    put16(entry + 24, framew);
+    put16(entry + 26, frameh);
+    put16(entry + 28, framecount);
+    put16(entry + 30, flags);
+    put32(entry + 32, packlen);
+    put32(entry + 36, packedlen);
+    put32(entry + 40, datalen);
+    put32(entry + 44, crc32c(0, packed, packedlen));
+    memcpy(pack + packlen, packed, packedlen);
+    packlen += packedlen;
+    /* the next asset starts aligned */
+    memset(pack + packlen, 0, ASSETPACK_ALIGN);
+    packlen = (packlen + ASSETPACK_ALIGN - 1) / ASSETPACK_ALIGN * ASSETPACK_ALIGN;
+    if (packed != data) free(packed);
+    free(data);
+    printf("%s: %s%s, %ld bytes%s\n", argv[i + 1], (flags & ASSETPACK_MIRROR) ? "mirror of " : "", file, packedlen, (flags & ASSETPACK_RLE) ? " (RLE)" : "");
+  }
+
+  memcpy(pack, ASSETPACK_MAGIC, 4);
+  put16(pack + 4, ASSETPACK_VERSION);
+  put16(pack + 6, count);
+  put32(pack + 8, crc32c(0, pack + tocoffset, count * ASSETPACK_ENTRYLEN));
+  put32(pack + 12, crc32c(0, pack, 12));
+  if (writefileatomic(argv[0], pack, packlen) != 0) {
+    fprintf(stderr, "mkpack: failed to write %s\n", argv[0]);
+    return(1);
+  }
+  free(pack);
+  return(0);
+}
@@ -0,0 +1,96 @@
+/* mkpixels: decodes a PNG file at build time, and writes its pixels to
+ * stdout as C arrays, in the pixel format of the sprite sheets (see
+ * assets.h), so the game doesn't have to decode it at startup. With -b,
+ * the pixels are written in binary instead, ready to go in an asset pack.
+ *
+ * usage: mkpixels name file.png >> pixels.h
+ *        mkpixels -b file.png > file.pix */
+
+#include <stdio.h>
+#include <string.h>         /* strcmp() */
+#include <SDL/SDL.h>
+#include <SDL/SDL_image.h>
+
+#include "assets.h"
+
+
+static void put32(unsigned char *p, unsigned long v) {
+  p[0] = (v >> 24) & 0xFF;
+  p[1] = (v >> 16) & 0xFF;
+  p[2] = (v >> 8) & 0xFF;
+  p[3] = v & 0xFF;
+}
+
+
+/* writes the pixels in the binary layout of asset packs */
+static int writebinary(SDL_Surface *pixels) {
+  unsigned char hdr[ASSETPIXELS_HEADERLEN];
+  int y;
+  memset(hdr, 0, sizeof(hdr));
+  memcpy(hdr, ASSETPIXELS_MAGIC, 4);
+  put32(hdr + 4, pixels->w);
+  put32(hdr + 8, pixels->h);
+  if (fwrite(hdr, 1, sizeof(hdr), stdout) != sizeof(hdr)) return(-1);
+  for (y = 0; y < pixels->h; y++) {
+    if (fwrite((Uint8 *)pixels->pixels + y * pixels->pitch, 4, pixels->w, stdout) != (size_t)pixels->w) return(-1);
+  }
+  return(0);
+}
+
+
+int main(int argc, char **argv) {
+  SDL_Surface *image, *pixels;
+  Uint32 *row;
+  int x, y, binary = 0;
+
+  if ((argc == 3) && (strcmp(argv[1], "-b") == 0)) {
+      binary = 1;
+    } else if (argc != 3) {
+      fprintf(stderr, "usage: mkpixels name file.png\n"
+                      "       mkpixels -b file.png\n");
+      return(1);
+  }
+
+  image = IMG_Load(argv[2]);
+  if (image == NULL) {
+    fprintf(stderr, "mkpixels: failed to load %s: %s\n", argv[2], SDL_GetError());
+    return(1);
+  }
+
+  /* same conversion as the game used to do at startup for every frame:
+   * blitting the image on a transparent surface of the sheets format */
+  pixels = SDL_CreateRGBSurface(SDL_SWSURFACE | SDL_SRCALPHA, image->w, image->h, 32, ASSET_RMASK, ASSET_GMASK, ASSET_BMASK, ASSET_AMASK);
+  if (pixels == NULL) {
+    fprintf(stderr, "mkpixels: out of memory\n");
+    return(1);
+  }
+  SDL_FillRect(pixels, NULL, 0x0);
+  SDL_BlitSurface(image, NULL, pixels, NULL);
+
+  if (binary != 0) {
+    SDL_LockSurface(pixels);
+    x = writebinary(pixels);
+    SDL_UnlockSurface(pixels);
+    if (x != 0) fprintf(stderr, "mkpixels: write error\n");
+    return((x != 0) ? 1 : 0);
+  }
+
+  printf("/* %s, decoded by mkpixels */\n", argv[2]);
+  printf("unsigned int %s_pixels[] = {", argv[1]);
+  SDL_LockSurface(pixels);
+  for (y = 0; y < pixels->h; y++) {
+    row = (Uint32 *)((Uint8 *)pixels->pixels + y * pixels->pitch);
+    for (x = 0; x < pixels->w; x++) {
+      if (((y * pixels->w) + x) % 8 == 0) printf("\n ");
+      printf(" 0x%08lX%s", (unsigned long)row[x], ((y == pixels->h - 1) && (x == pixels->w - 1)) ? "" : ",");
+    }
+  }
+  SDL_UnlockSurface(pixels);
+  printf("\n};\n");
+  printf("unsigned int %s_pixels_w = %d;\n", argv[1], pixels->w);
+  printf("unsigned int %s_pixels_len = %d;\n", argv[1], pixels->w * pixels->h);
+
+  SDL_FreeSurface(pixels);
+  SDL_FreeSurface(image);
+  return(0);
+}
@@ -0,0 +1,108 @@
+/* painting tools of the level editor */
+
+#include <stddef.h>         /* NULL */
+
+#include "level.h"
+#include "paint.h"
+
+
+/* puts tile at (x,y,z) if it is inside the world. returns 1 if the cell
+ * changed, 0 otherwise. */
+static int plot(struct worldstruct *world, int x, int y, int z, int tile, paint_callback callback, void *userdata) {
+  int oldtile;
+  if ((x < 0) || (y < 0) || (x >= world->width) || (y >= world->height)) return(0);
+  oldtile = world->tilemap[x][y][z];
+  if (oldtile == tile) return(0);
+  world->tilemap[x][y][z] = tile;
+  if (callback != NULL) callback(x, y, z, oldtile, userdata);
+  return(1);
+}
+
+
+int paint_floodfill(struct worldstruct *world, int x, int y, int z, int tile, paint_callback callback, void *userdata) {
+  /* seeds still to be filled. every filled span pushes at most one seed
+   * per cell plus one per neighbour row, so twice the number of cells is
+   * always enough */
+  struct {
+    unsigned short x;
+    unsigned short y;
+  } stack[2 * WORLD_MAXW * WORLD_MAXH];
+  int top = 0, count = 0, target, left, right, i, row, inrun;
+  if ((x < 0) || (y < 0) || (x >= world->width) || (y >= world->height)) return(0);
+  target = world->tilemap[x][y][z];
+  if (target == tile) return(0);
+  stack[top].x = x;
+  stack[top].y = y;
+  top++;
+  while (top > 0) {
+    top--;
+    x = stack[top].x;
+    y = stack[top].y;
+    if (world->tilemap[x][y][z] != target) continue; /* filled since it has been pushed */
+    /* extend the seed to the whole span of target cells on its row */
+    for (left = x; (left > 0) && (world->tilemap[left - 1][y][z] == target); left--);
+    for (right = x; (right < world->width - 1) && (world->tilemap[right + 1][y][z] == target); right++);
+    for (i = left; i <= right; i++) count += plot(world, i, y, z, tile, callback, userdata);
+    /* push one seed per run of target cells on the rows below and above */
+    for (row = y - 1; row <= y + 1; row += 2) {
+      if ((row < 0) || (row >= world->height)) continue;
+      inrun = 0;
+      for (i = left; i <= right; i++) {
+        if (world->tilemap[i][row][z] != target) {
+            inrun = 0;
+          } else if (inrun == 0) {
+            inrun = 1;
+            if (top == (int)(sizeof(stack) / sizeof(stack[0]))) return(count); /* can't happen */
+            stack[top].x = i;
+            stack[top].y = row;
+            top++;
+        }
+      }
+    }
+  }
+  return(count);
+}
+
+
+int paint_rect(struct worldstruct *world, int x1, int y1, int x2, int y2, int z, int tile, paint_callback callback, void *userdata) {
+  int x, y, t, count = 0;
+  if (x1 > x2) {
+    t = x1;
+    x1 = x2;
+    x2 = t;
+  }
+  if (y1 > y2) {
+    t = y1;
+    y1 = y2;
+    y2 = t;
+  }
+  /* row by row, so that the undo journal can merge each row into one run */
+  for (y = y1; y <= y2; y++) {
+    for (x = x1; x <= x2; x++) count += plot(world, x, y, z, tile, callback, userdata);
+  }
+  return(count);
+}
+
+
+int paint_line(struct worldstruct *world, int x1, int y1, int x2, int y2, int z, int tile, paint_callback callback, void *userdata) {
+  int dx, dy, sx, sy, err, e2, count = 0;
+  dx = (x2 > x1) ? x2 - x1 : x1 - x2;
+  dy = (y2 > y1) ? y1 - y2 : y2 - y1; /* negative */
+  sx = (x2 > x1) ? 1 : -1;
+  sy = (y2 > y1) ? 1 : -1;
+  err = dx + dy;
+  for (;;) {
+    count += plot(world, x1, y1, z, tile, callback, userdata);
+    if ((x1 == x2) && (y1 == y2)) break;
+    e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x1 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y1 += sy;
+    }
+  }
+  return(count);
+}
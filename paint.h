@@ -0,0 +1,30 @@
+/* painting tools of the level editor
+ *
+ * All tools work on a single layer of the world and write the tiles
+ * themselves, calling back for every cell they changed (after changing it)
+ * so that the caller can record it for undo and redraw it. Cells already
+ * holding the tile are left alone and not reported. */
+
+#ifndef PAINT_H_SENTINEL
+#define PAINT_H_SENTINEL
+
+#include "level.h"
+
+/* called for every cell (x,y,z) changed by a tool. oldtile is the tile the
+ * cell held before. */
+typedef void (*paint_callback)(int x, int y, int z, int oldtile, void *userdata);
+
+/* replaces the area of identical tiles around (x,y) on layer z by tile.
+ * scanline fill with an explicit stack, limited to the world's size.
+ * returns the number of changed cells. */
+int paint_floodfill(struct worldstruct *world, int x, int y, int z, int tile, paint_callback callback, void *userdata);
+
+/* fills the rectangle between the (x1,y1) and (x2,y2) corners, included.
+ * returns the number of changed cells. */
+int paint_rect(struct worldstruct *world, int x1, int y1, int x2, int y2, int z, int tile, paint_callback callback, void *userdata);
+
+/* draws a line from (x1,y1) to (x2,y2), both included (Bresenham). returns
+ * the number of changed cells. */
+int paint_line(struct worldstruct *world, int x1, int y1, int x2, int y2, int z, int tile, paint_callback callback, void *userdata);
+
+#endif
@@ -0,0 +1,157 @@
+/* memory registry of Mike O'Possum */
+
+#include <stdio.h>
+#include <stdlib.h>         /* free() */
+#include <string.h>         /* strncpy(), strcmp() */
+#include <signal.h>         /* signal(), sig_atomic_t */
+#include <pthread.h>
+#include <SDL/SDL.h>
+
+#include "registry.h"
+
+
+struct registryentry {
+  void *ptr;
+  long bytes;
+  char name[REGISTRY_NAMELEN + 1];
+  char *owner;
+  char format[REGISTRY_FORMATLEN + 1];
+};
+
+static struct registryentry entry[REGISTRY_MAX];
+static int entrycount;
+static long totalbytes;
+static int untracked;       /* allocations that didn't fit in the registry */
+static pthread_mutex_t registrylock = PTHREAD_MUTEX_INITIALIZER;
+static volatile sig_atomic_t dumprequested;
+
+
+static void addentry(void *ptr, long bytes, char *name, char *owner, char *format) {
+  struct registryentry *e;
+  if (ptr == NULL) return;
+  pthread_mutex_lock(&registrylock);
+  if (entrycount == REGISTRY_MAX) {
+      untracked++;
+    } else {
+      e = &(entry[entrycount++]);
+      e->ptr = ptr;
+      e->bytes = bytes;
+      strncpy(e->name, name, REGISTRY_NAMELEN);
+      e->name[REGISTRY_NAMELEN] = 0;
+      e->owner = owner;
+      strncpy(e->format, format, REGISTRY_FORMATLEN);
+      e->format[REGISTRY_FORMATLEN] = 0;
+      totalbytes += bytes;
+  }
+  pthread_mutex_unlock(&registrylock);
+}
+
+
+static void removeentry(void *ptr) {
+  int i;
+  if (ptr == NULL) return;
+  pthread_mutex_lock(&registrylock);
+  /* the latest allocations are usually the first ones freed */
+  for (i = entrycount - 1; i >= 0; i--) {
+    if (entry[i].ptr != ptr) continue;
+    totalbytes -= entry[i].bytes;
+    entry[i] = entry[--entrycount];
+    break;
+  }
+  pthread_mutex_unlock(&registrylock);
+}
+
+
+SDL_Surface *registry_addsurface(SDL_Surface *surface, char *name, char *owner) {
+  char format[REGISTRY_FORMATLEN + 1];
+  long bytes = 0;
+  if (surface == NULL) return(NULL);
+  /* a window on pixels owned by someone else costs nothing */
+  if ((surface->flags & SDL_PREALLOC) == 0) bytes = (long)surface->h * surface->pitch;
+  sprintf(format, "%dbpp%s%s", surface->format->BitsPerPixel, (surface->format->Amask != 0) ? " alpha" : "", (bytes == 0) ? " window" : "");
+  addentry(surface, bytes, name, owner, format);
+  return(surface);
+}
+
+
+void *registry_addbuffer(void *buffer, long bytes, char *name, char *owner) {
+  addentry(buffer, bytes, name, owner, "buffer");
+  return(buffer);
+}
+
+
+void registry_freesurface(SDL_Surface *surface) {
+  if (surface == NULL) return;
+  removeentry(surface);
+  SDL_FreeSurface(surface);
+}
+
+
+void registry_freebuffer(void *buffer) {
+  removeentry(buffer);
+  free(buffer);
+}
+
+
+void registry_totals(int *count, long *bytes) {
+  pthread_mutex_lock(&registrylock);
+  if (count != NULL) *count = entrycount;
+  if (bytes != NULL) *bytes = totalbytes;
+  pthread_mutex_unlock(&registrylock);
+}
+
+
+void registry_report(FILE *fd) {
+  char *owner[REGISTRY_MAX];
+  long ownerbytes[REGISTRY_MAX];
+  int ownercount[REGISTRY_MAX];
+  int i, o, owners = 0;
+  pthread_mutex_lock(&registrylock);
+  for (i = 0; i < entrycount; i++) {
+    for (o = 0; o < owners; o++) {
+      if (strcmp(owner[o], entry[i].owner) == 0) break;
+    }
+    if (o == owners) {
+      owner[o] = entry[i].owner;
+      ownerbytes[o] = 0;
+      ownercount[o] = 0;
+      owners++;
+    }
+    ownerbytes[o] += entry[i].bytes;
+    ownercount[o]++;
+  }
+  fprintf(fd, "graphics memory: %ld bytes in %d surfaces and buffers", totalbytes, entrycount);
+  if (untracked > 0) fprintf(fd, " (and %d untracked)", untracked);
+  fprintf(fd, "\n");
+  for (o = 0; o < owners; o++) fprintf(fd, "  %-12s %10ld bytes in %d\n", owner[o], ownerbytes[o], ownercount[o]);
+  for (i = 0; i < entrycount; i++) fprintf(fd, "  %-12s %-31s %-23s %10ld bytes\n", entry[i].owner, entry[i].name, entry[i].format, entry[i].bytes);
+  pthread_mutex_unlock(&registrylock);
+}
+
+
+static void dumphandler(int signum) {
+  (void)signum;
+  dumprequested = 1;
+}
+
+
+void registry_dumponsignal(int signum) {
+  signal(signum, dumphandler);
+}
+
+
+void registry_poll(FILE *fd) {
+  if (dumprequested == 0) return;
+  dumprequested = 0;
+  registry_report(fd);
+}
+
+
+int registry_leaks(FILE *fd) {
+  int i, leaks;
+  pthread_mutex_lock(&registrylock);
+  leaks = entrycount;
+  for (i = 0; i < entrycount; i++) fprintf(fd, "leak: %s %s (%s, %ld bytes)\n", entry[i].owner, entry[i].name, entry[i].format, entry[i].bytes);
+  pthread_mutex_unlock(&registrylock);
+  return(leaks);
+}
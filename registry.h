@@ -0,0 +1,56 @@
+/* memory registry of Mike O'Possum
+ *
+ * Every surface and pixel buffer the game allocates for its graphics is
+ * recorded here, with a name, the module that owns it, its pixel format
+ * and how many bytes it costs, so the memory used by graphics is known
+ * at any time, broken down by owner. Surfaces that only point to pixels
+ * owned by something else (windows on a sprite sheet) are recorded too,
+ * at no cost.
+ *
+ * The whole registry can be printed at any time, or on a signal, and
+ * whatever is still recorded at shutdown is a leak. Thread safe. */
+
+#ifndef REGISTRY_H_SENTINEL
+#define REGISTRY_H_SENTINEL
+
+#include <stdio.h>
+#include <SDL/SDL.h>
+
+#define REGISTRY_MAX 1024
+#define REGISTRY_NAMELEN 31
+#define REGISTRY_FORMATLEN 23
+
+/* records a surface, once allocated. returns the surface. */
+SDL_Surface *registry_addsurface(SDL_Surface *surface, char *name, char *owner);
+
+/* records a buffer of pixels (or any other graphics data), once allocated.
+ * returns the buffer. */
+void *registry_addbuffer(void *buffer, long bytes, char *name, char *owner);
+
+/* forgets a surface and frees it */
+void registry_freesurface(SDL_Surface *surface);
+
+/* forgets a buffer and frees it */
+void registry_freebuffer(void *buffer);
+
+/* tells how many surfaces and buffers are recorded, and how many bytes
+ * they cost. either pointer may be NULL. */
+void registry_totals(int *count, long *bytes);
+
+/* prints the totals per owner, then everything recorded, to fd */
+void registry_report(FILE *fd);
+
+/* asks for a report to be printed by registry_poll() whenever the
+ * process gets the signal signum (SIGUSR1...) */
+void registry_dumponsignal(int signum);
+
+/* prints a report to fd if the signal came since last time. meant to be
+ * called from the main loop, as a report can't be printed by a signal
+ * handler. */
+void registry_poll(FILE *fd);
+
+/* prints what is still recorded, to be called once everything has been
+ * freed. returns the number of leaks. */
+int registry_leaks(FILE *fd);
+
+#endif
@@ -19902,994 +19902,3 @@ unsigned char bg_png[] = {
   0x60, 0x82
 };
 unsigned int bg_png_len = 238802;
-unsigned char possum_left_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x5a,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x79, 0x69, 0x54, 0x92, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
-  0x00, 0x4e, 0x50, 0x4c, 0x54, 0x45, 0x51, 0x90, 0x7f, 0x00, 0x00, 0x00,
-  0x0d, 0x0d, 0x0d, 0x2d, 0x23, 0x1a, 0x28, 0x28, 0x28, 0x40, 0x40, 0x40,
-  0x56, 0x43, 0x32, 0x5c, 0x4f, 0x1d, 0x53, 0x53, 0x53, 0x64, 0x64, 0x64,
-  0x8d, 0x70, 0x5a, 0x97, 0x7d, 0x17, 0x7c, 0x7c, 0x7c, 0x88, 0x88, 0x88,
-  0xc6, 0xa3, 0x80, 0xaa, 0xaa, 0xaa, 0xc0, 0xa9, 0x8f, 0xd5, 0xb7, 0x0d,
-  0xf5, 0xc6, 0x05, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xf2, 0xbc, 0xa2,
-  0xf3, 0xd5, 0xbe, 0xf9, 0xdb, 0x73, 0xff, 0xf5, 0xc1, 0xff, 0xff, 0xff,
-  0x11, 0x2a, 0x78, 0xb1, 0x00, 0x00, 0x00, 0x01, 0x74, 0x52, 0x4e, 0x53,
-  0x00, 0x40, 0xe6, 0xd8, 0x66, 0x00, 0x00, 0x00, 0x01, 0x62, 0x4b, 0x47,
-  0x44, 0x00, 0x88, 0x05, 0x1d, 0x48, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48,
-  0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01, 0x00,
-  0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07,
-  0xdd, 0x05, 0x1e, 0x0c, 0x0a, 0x0d, 0x97, 0x16, 0x67, 0xde, 0x00, 0x00,
-  0x11, 0x6f, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x5d, 0x0b, 0x7b,
-  0x9c, 0x38, 0x12, 0x1c, 0xa6, 0x41, 0x04, 0x61, 0xb3, 0xcb, 0x6d, 0xc6,
-  0xe3, 0xfc, 0xff, 0x3f, 0x7a, 0xfd, 0x90, 0x40, 0x3c, 0xf4, 0xea, 0x99,
-  0xe4, 0x4b, 0x9c, 0xe1, 0x76, 0x73, 0x1b, 0x7b, 0x9a, 0x12, 0xaa, 0xee,
-  0xae, 0x92, 0x00, 0xfb, 0x72, 0x79, 0x1d, 0x5f, 0xe6, 0xe8, 0xf1, 0x78,
-  0xcd, 0xc2, 0x5f, 0x46, 0xf9, 0xfc, 0x09, 0xaf, 0x69, 0xf8, 0x5b, 0x0e,
-  0x20, 0xae, 0x91, 0xf2, 0x17, 0xe7, 0x7f, 0x11, 0xe7, 0x33, 0x30, 0xe7,
-  0xf7, 0x17, 0xe7, 0xbf, 0x87, 0xf4, 0xfd, 0x02, 0x2c, 0x98, 0x7b, 0x58,
-  0x39, 0xef, 0xfd, 0xf1, 0x9a, 0x9e, 0x27, 0x48, 0x9f, 0x66, 0x7c, 0x4a,
-  0xac, 0x2a, 0xa8, 0x0d, 0xe7, 0x08, 0x78, 0xff, 0xc4, 0xe3, 0x3e, 0x03,
-  0xfc, 0xd2, 0xe9, 0x51, 0xb1, 0xa7, 0x76, 0x21, 0x15, 0x68, 0x8f, 0x48,
-  0x5f, 0xed, 0xf8, 0x1e, 0xc0, 0xaa, 0x83, 0x82, 0x1e, 0x9b, 0x3b, 0xf4,
-  0xc4, 0x79, 0x2f, 0x94, 0x13, 0xe1, 0x1a, 0xca, 0x7f, 0xd9, 0x90, 0x1f,
-  0x75, 0x21, 0x35, 0x68, 0x4a, 0xe9, 0x53, 0x8d, 0x4f, 0x87, 0xa5, 0x81,
-  0xa2, 0x42, 0x87, 0xfe, 0xfe, 0x39, 0xf6, 0xd0, 0x8f, 0xc8, 0xf9, 0x0c,
-  0xca, 0x1a, 0xff, 0x75, 0x43, 0xd6, 0xbb, 0x90, 0x6a, 0x34, 0xa5, 0xf4,
-  0xa9, 0xc6, 0xa7, 0xc3, 0xd2, 0x40, 0x51, 0xa1, 0x23, 0xdb, 0x18, 0x83,
-  0x7f, 0x62, 0x99, 0xd3, 0xdf, 0x54, 0x92, 0xfe, 0xeb, 0x86, 0xac, 0x77,
-  0x21, 0xc0, 0x4d, 0xad, 0x02, 0x4d, 0x29, 0x7d, 0xaa, 0xf1, 0x85, 0x41,
-  0x7d, 0x31, 0x96, 0x0e, 0x6a, 0x9c, 0x99, 0xed, 0xd1, 0x71, 0x4e, 0x11,
-  0x23, 0x1e, 0xb5, 0xb4, 0xeb, 0xa6, 0x47, 0x9b, 0x29, 0x3a, 0x17, 0x22,
-  0x4d, 0xad, 0x02, 0x4d, 0x29, 0x7d, 0x2a, 0xfa, 0x74, 0x58, 0xf5, 0x50,
-  0x40, 0x50, 0xe3, 0x3c, 0x52, 0xd0, 0xd8, 0xd3, 0xe7, 0x91, 0xf3, 0xd9,
-  0x07, 0x56, 0xf1, 0xfe, 0xf8, 0x90, 0x2b, 0x32, 0x45, 0x49, 0xc5, 0x86,
-  0xf3, 0xb2, 0x09, 0x52, 0x49, 0x9f, 0x7e, 0x2e, 0xaa, 0xb1, 0xea, 0xa1,
-  0xe8, 0x7b, 0x30, 0x62, 0x5d, 0x23, 0xd4, 0x2c, 0x9c, 0xcb, 0x44, 0xf8,
-  0xe3, 0x3e, 0x17, 0xf3, 0xfe, 0xe0, 0x90, 0xa1, 0xb6, 0x90, 0x14, 0x54,
-  0xb0, 0x90, 0x31, 0x5a, 0x5f, 0x3a, 0x41, 0x3a, 0xe9, 0x53, 0xcf, 0x45,
-  0x3d, 0x56, 0x3d, 0x14, 0x60, 0x99, 0xc1, 0xd8, 0x22, 0xe9, 0x9f, 0x9f,
-  0xe3, 0x18, 0x70, 0x7e, 0xa7, 0x53, 0xf1, 0x5f, 0xee, 0xc4, 0xfb, 0x4f,
-  0x73, 0x06, 0xfa, 0x42, 0xd2, 0x50, 0xa1, 0x98, 0x20, 0x95, 0xf4, 0x29,
-  0xe7, 0xc2, 0x63, 0xad, 0x50, 0x79, 0x2c, 0x05, 0x14, 0x8c, 0x8e, 0x74,
-  0x74, 0xb3, 0x23, 0x27, 0xbe, 0xa3, 0x9c, 0xa1, 0xc0, 0x1f, 0x25, 0xac,
-  0xab, 0xa6, 0x47, 0xcb, 0x9e, 0x8e, 0x8a, 0x6a, 0x34, 0x50, 0x4a, 0x9f,
-  0x92, 0x3e, 0x8f, 0x25, 0x1d, 0xb7, 0x0c, 0x4b, 0x01, 0x85, 0xad, 0x1d,
-  0x2f, 0xac, 0xe5, 0x00, 0x2e, 0x74, 0x4f, 0xf9, 0x7c, 0xbf, 0x0b, 0xf3,
-  0x65, 0x9d, 0x5d, 0xeb, 0x0c, 0x14, 0xec, 0xe9, 0x5d, 0x08, 0xd4, 0xa2,
-  0x81, 0x23, 0xdd, 0x49, 0xdf, 0x5c, 0x2a, 0x7d, 0x2a, 0xfa, 0x74, 0x58,
-  0x1a, 0x28, 0xc0, 0x2b, 0x86, 0x6b, 0x77, 0xe5, 0x3e, 0xce, 0xff, 0x50,
-  0x3b, 0x97, 0x38, 0xa2, 0x7d, 0x2e, 0xa2, 0x5d, 0xe7, 0x0c, 0x00, 0x34,
-  0xec, 0x69, 0x5d, 0x88, 0x26, 0x57, 0xa0, 0x97, 0x90, 0x83, 0xf4, 0xcd,
-  0x49, 0xe9, 0xd3, 0xd2, 0x07, 0xf5, 0x58, 0x2a, 0x28, 0xa0, 0xd9, 0x5b,
-  0x49, 0x3f, 0x1c, 0x54, 0xee, 0x05, 0x6b, 0x5f, 0x8d, 0x33, 0x20, 0x39,
-  0x55, 0xb0, 0xa7, 0x74, 0x21, 0x9a, 0x5c, 0x41, 0xed, 0x03, 0xa7, 0x7d,
-  0xdc, 0x18, 0x96, 0x19, 0xc9, 0x48, 0x9f, 0x86, 0x3e, 0xc4, 0x1a, 0x03,
-  0x2c, 0x0e, 0x28, 0x90, 0x59, 0x0d, 0xd4, 0x95, 0x59, 0xbf, 0x0e, 0xd7,
-  0xfb, 0xaa, 0xe7, 0x07, 0xde, 0xf3, 0xac, 0xab, 0x9c, 0x01, 0xf4, 0x6e,
-  0x4a, 0x2b, 0xd9, 0xd3, 0xb9, 0x10, 0x4d, 0xae, 0x04, 0xda, 0x37, 0x2e,
-  0xa9, 0x31, 0xe6, 0xa4, 0x4f, 0x47, 0xdf, 0x01, 0x0b, 0x03, 0xb2, 0x32,
-  0xab, 0x83, 0xba, 0x5e, 0xaf, 0x88, 0x86, 0xa4, 0xd3, 0x45, 0xcf, 0x57,
-  0x97, 0x25, 0xf8, 0x55, 0x69, 0xf2, 0x23, 0x9e, 0x72, 0x2e, 0x70, 0xef,
-  0x2a, 0x67, 0x10, 0xd4, 0x51, 0x15, 0x7b, 0x3a, 0x17, 0xa2, 0xc9, 0x95,
-  0x40, 0xfb, 0x9c, 0xfa, 0xd1, 0xa4, 0xe4, 0xa4, 0x4f, 0x45, 0xdf, 0x16,
-  0xeb, 0xee, 0x90, 0x72, 0x58, 0x3a, 0xa8, 0xcb, 0xb5, 0xbd, 0x8e, 0x57,
-  0x24, 0xfd, 0xfa, 0x3f, 0xe4, 0xfc, 0x4a, 0x51, 0x2d, 0x1e, 0x57, 0xa7,
-  0x74, 0x18, 0x48, 0xcb, 0x9c, 0x2c, 0xed, 0x2a, 0x67, 0xa0, 0x66, 0x4f,
-  0xe5, 0x42, 0x34, 0x68, 0x81, 0xf6, 0x55, 0x48, 0x9f, 0x8a, 0x3e, 0x1d,
-  0x96, 0x0e, 0x0a, 0x49, 0x6f, 0xb1, 0xae, 0x07, 0xfc, 0xe3, 0x07, 0xd5,
-  0xf7, 0xb5, 0x5d, 0x39, 0xa7, 0x48, 0x96, 0x39, 0xa9, 0x81, 0xb4, 0xa6,
-  0x2b, 0x9c, 0x81, 0x96, 0x3d, 0x9d, 0x0b, 0xd1, 0xa0, 0x5d, 0xb1, 0x13,
-  0x39, 0xed, 0xab, 0x90, 0x3e, 0x5d, 0xaa, 0x20, 0x98, 0xc3, 0x8a, 0x40,
-  0x9d, 0x61, 0x29, 0xa1, 0x2e, 0xc4, 0x31, 0x93, 0x7e, 0xc5, 0xe0, 0xe1,
-  0xfb, 0xf7, 0x21, 0xe0, 0x1c, 0x8f, 0x22, 0xf3, 0xae, 0x73, 0x06, 0x3a,
-  0xf6, 0xb4, 0x2e, 0x44, 0x83, 0x86, 0x73, 0xe2, 0xb5, 0x8f, 0xa5, 0x0f,
-  0x3f, 0x42, 0x95, 0xc1, 0x3d, 0x30, 0x21, 0x7d, 0x1a, 0xfa, 0x08, 0xcc,
-  0x61, 0xcd, 0xd7, 0x45, 0x63, 0x3f, 0x73, 0x58, 0x3a, 0x28, 0x29, 0xf5,
-  0x8e, 0x48, 0x6f, 0xbb, 0xe1, 0xfb, 0xe7, 0xca, 0x39, 0x9e, 0x88, 0x1b,
-  0x46, 0x09, 0xe9, 0x1a, 0x67, 0xa0, 0x64, 0x4f, 0xe9, 0x42, 0x74, 0x68,
-  0xd7, 0xd6, 0x69, 0x1f, 0x4b, 0xdf, 0x3c, 0xae, 0x5d, 0x30, 0x25, 0x7d,
-  0x2a, 0xfa, 0x30, 0xcc, 0x61, 0xd1, 0xa7, 0xc7, 0x4d, 0xbf, 0x8d, 0x63,
-  0x29, 0xa1, 0x48, 0xd5, 0xaf, 0x5d, 0x87, 0x9c, 0xb7, 0xc3, 0xf0, 0xf9,
-  0x19, 0x62, 0x71, 0xf7, 0x2b, 0x63, 0x5d, 0xe1, 0x0c, 0xb4, 0x1e, 0x52,
-  0xe7, 0x42, 0x74, 0x68, 0x57, 0xaf, 0x7d, 0x8b, 0xf4, 0xad, 0x5d, 0x30,
-  0x21, 0x7d, 0x1a, 0xfa, 0x78, 0x88, 0x0e, 0x6b, 0x24, 0xa8, 0x6b, 0x90,
-  0x99, 0x71, 0x2c, 0x1d, 0x14, 0x83, 0xb5, 0x1d, 0xc2, 0x48, 0xa1, 0x5f,
-  0x57, 0xeb, 0x4f, 0xed, 0x0c, 0xee, 0xf7, 0x22, 0xd2, 0x15, 0xce, 0x20,
-  0xcb, 0x1e, 0x9c, 0x27, 0xb7, 0xce, 0x85, 0xe8, 0x72, 0x65, 0xd1, 0x3e,
-  0x92, 0xbe, 0x9d, 0xf2, 0xc5, 0xa5, 0x4f, 0x45, 0x5f, 0x88, 0x75, 0x80,
-  0x8a, 0x62, 0xe9, 0xa0, 0xf0, 0xab, 0x9c, 0xc8, 0x4c, 0xfa, 0xf7, 0x15,
-  0x0a, 0x2b, 0x62, 0xc4, 0x12, 0xe8, 0xa1, 0x2f, 0x61, 0x5d, 0xe3, 0x0c,
-  0xb4, 0x1e, 0x52, 0xe7, 0x42, 0x74, 0x68, 0xd7, 0x8d, 0xf6, 0xb5, 0xed,
-  0x58, 0x24, 0x7d, 0x2a, 0xfa, 0x42, 0xac, 0x00, 0x2a, 0x83, 0xa5, 0x82,
-  0xa2, 0xed, 0x68, 0x6a, 0x6f, 0x44, 0xfa, 0xf7, 0xef, 0xd7, 0xa0, 0x7b,
-  0xe1, 0x7a, 0x7f, 0xa4, 0xcd, 0x1e, 0x28, 0xb9, 0xb5, 0xaa, 0x72, 0x06,
-  0x4a, 0x0f, 0xa9, 0x74, 0x21, 0x2a, 0xb4, 0x9d, 0xf6, 0x15, 0x4a, 0x9f,
-  0x8a, 0xbe, 0x10, 0x8b, 0xa0, 0xe6, 0xcf, 0x12, 0xac, 0x7a, 0x28, 0x70,
-  0x94, 0xcf, 0xa3, 0xb5, 0xa6, 0x1d, 0x90, 0x73, 0x5c, 0xc1, 0xce, 0x6f,
-  0x6f, 0x6f, 0x33, 0x97, 0xfa, 0x0c, 0x3d, 0x96, 0xfa, 0xa5, 0xe8, 0x09,
-  0x49, 0x8d, 0x33, 0xd0, 0x7a, 0x48, 0x9d, 0x0b, 0xd1, 0xa1, 0x6d, 0xb5,
-  0x6f, 0xbc, 0x07, 0xbb, 0xb6, 0x71, 0xe9, 0x53, 0xd1, 0x17, 0x62, 0x6d,
-  0xa1, 0x52, 0x58, 0xb5, 0x50, 0x00, 0xc6, 0xf0, 0x77, 0x90, 0x72, 0x6b,
-  0x8c, 0x41, 0xbd, 0xc3, 0x14, 0x78, 0x7b, 0xfb, 0xef, 0xc7, 0xdb, 0x9b,
-  0xdb, 0xbf, 0xed, 0xc7, 0xb9, 0xf4, 0xc1, 0x19, 0x8d, 0x33, 0xd0, 0x7a,
-  0x48, 0x9d, 0x0b, 0xd1, 0xa0, 0x9d, 0x6b, 0x5f, 0x56, 0xfa, 0x34, 0xf4,
-  0xed, 0xb0, 0xe6, 0x42, 0xac, 0x4a, 0x28, 0xb8, 0xdd, 0x0c, 0x6d, 0x47,
-  0x79, 0x83, 0x7f, 0xbd, 0x0a, 0xe5, 0x3f, 0xde, 0xfc, 0x9d, 0x27, 0x72,
-  0x52, 0xc6, 0x94, 0xdd, 0x5b, 0x55, 0x39, 0x03, 0x1d, 0x7b, 0x5a, 0x17,
-  0x52, 0x8d, 0x46, 0x7b, 0xf2, 0x3c, 0x33, 0x3b, 0xed, 0xcb, 0x49, 0x9f,
-  0x86, 0xbe, 0x1d, 0xd6, 0x58, 0x88, 0x55, 0x0b, 0x45, 0xa4, 0x8f, 0xf7,
-  0xb5, 0xc5, 0xcd, 0xf3, 0xb7, 0x6f, 0xd8, 0xda, 0xdf, 0xfe, 0xfb, 0x26,
-  0xbb, 0x94, 0x14, 0x43, 0xa4, 0x9b, 0x12, 0xca, 0x55, 0xce, 0x40, 0xc5,
-  0x9e, 0xda, 0x85, 0x54, 0xa2, 0x79, 0xed, 0xe3, 0x3e, 0xe8, 0xb4, 0xaf,
-  0x48, 0xfa, 0x14, 0xf4, 0x1d, 0xb1, 0xe6, 0x22, 0x2c, 0x25, 0x94, 0x68,
-  0x3a, 0xc6, 0x7d, 0xc3, 0xe3, 0xed, 0x9f, 0x7f, 0x7e, 0x60, 0xa1, 0x53,
-  0x0e, 0x8c, 0x77, 0x26, 0xbd, 0xef, 0xed, 0x64, 0xb2, 0x8c, 0xeb, 0x9c,
-  0x81, 0x86, 0x3d, 0xbd, 0x0b, 0xa9, 0x44, 0xf3, 0xda, 0x47, 0x34, 0x2c,
-  0xda, 0x57, 0x20, 0x7d, 0x2a, 0xfa, 0x74, 0x58, 0xda, 0x4c, 0xb9, 0x04,
-  0x77, 0x97, 0xfc, 0x31, 0xca, 0x7d, 0x08, 0x79, 0xbc, 0x64, 0xec, 0xa7,
-  0xc9, 0x9a, 0x34, 0xe5, 0x2a, 0x67, 0xa0, 0x62, 0x4f, 0xed, 0x42, 0xea,
-  0xd1, 0xc0, 0xb2, 0xf6, 0x89, 0xf4, 0x89, 0xf6, 0x9d, 0x48, 0xdf, 0x11,
-  0x48, 0x47, 0x5f, 0x09, 0x56, 0xff, 0x14, 0xa8, 0x2d, 0xf3, 0x3c, 0x99,
-  0xf7, 0xf5, 0x29, 0x81, 0xf9, 0xb3, 0xa7, 0x7b, 0x14, 0x76, 0xfa, 0x48,
-  0x97, 0xba, 0xca, 0x19, 0x68, 0x33, 0x45, 0xe7, 0x42, 0x34, 0x68, 0x30,
-  0x2d, 0xda, 0x77, 0x90, 0xbe, 0xcf, 0x55, 0xfa, 0x9e, 0x42, 0x1f, 0x45,
-  0xe5, 0xb0, 0xcc, 0x21, 0xc3, 0x74, 0x50, 0x7b, 0xde, 0xb9, 0xce, 0x5d,
-  0xb3, 0x47, 0xd2, 0xef, 0x48, 0x7a, 0x6f, 0xec, 0x34, 0x4d, 0x49, 0x55,
-  0x57, 0x39, 0x03, 0x2d, 0x7b, 0x3a, 0x17, 0xa2, 0xcc, 0x4b, 0xaf, 0x7d,
-  0x3b, 0xe9, 0x23, 0x64, 0x27, 0x7d, 0xbd, 0x79, 0x0a, 0x7d, 0xac, 0x3d,
-  0xe7, 0x58, 0x9f, 0x82, 0x75, 0x96, 0x61, 0x4a, 0xa8, 0x4d, 0x2d, 0x00,
-  0x11, 0x3e, 0x32, 0xeb, 0xfc, 0x58, 0x01, 0xce, 0x04, 0x15, 0x3a, 0xb2,
-  0x6e, 0x8d, 0xc9, 0x49, 0x7a, 0xad, 0x33, 0xd0, 0x7a, 0x48, 0x9d, 0x0b,
-  0x79, 0x00, 0x4d, 0xa4, 0xef, 0x9b, 0x3f, 0xde, 0xdc, 0x73, 0x0a, 0x4e,
-  0xfa, 0xec, 0x51, 0xf9, 0x8a, 0xe8, 0x8b, 0x75, 0xdb, 0x23, 0xd6, 0x27,
-  0x63, 0x21, 0x58, 0x7f, 0x04, 0xd3, 0x42, 0xad, 0x0a, 0x66, 0x91, 0x75,
-  0xe2, 0x9c, 0xd4, 0x8d, 0x12, 0xbf, 0x97, 0x54, 0xb1, 0xa2, 0x18, 0x79,
-  0x2b, 0x57, 0xe9, 0x0c, 0x0a, 0xd8, 0x83, 0xde, 0x9c, 0x09, 0x8b, 0xc6,
-  0x85, 0x3c, 0xe2, 0x58, 0xcf, 0xb4, 0x4f, 0xa4, 0x6f, 0x3a, 0xb7, 0x3b,
-  0x39, 0xfa, 0xb0, 0x7d, 0x9a, 0xe4, 0x3c, 0x6e, 0xc1, 0x08, 0x0b, 0xc1,
-  0xb8, 0xe3, 0x3e, 0x11, 0x8a, 0x39, 0xb7, 0x56, 0x48, 0x1f, 0xe9, 0xff,
-  0xb8, 0xdd, 0x51, 0xa6, 0x18, 0x64, 0x9d, 0x44, 0xbd, 0x64, 0xad, 0x5e,
-  0xeb, 0x0c, 0x1e, 0xf1, 0x90, 0xf5, 0x2e, 0xe4, 0x21, 0xc7, 0xba, 0xd7,
-  0x3e, 0x96, 0xbe, 0x09, 0x71, 0xac, 0x82, 0x3e, 0x63, 0x13, 0xce, 0x18,
-  0xf6, 0x3a, 0x4b, 0x50, 0x18, 0x65, 0x6c, 0x14, 0x4d, 0x09, 0x05, 0x86,
-  0x92, 0x16, 0xe8, 0x81, 0xa2, 0x71, 0xe4, 0x14, 0x71, 0xd5, 0x0e, 0x20,
-  0xa4, 0x27, 0x42, 0x77, 0x6b, 0x8f, 0x22, 0x67, 0x10, 0x9a, 0xe4, 0x2a,
-  0xf6, 0x36, 0x68, 0x0a, 0x17, 0xa2, 0x76, 0xac, 0x4e, 0xfb, 0x66, 0xa7,
-  0x7d, 0x7c, 0x27, 0x76, 0x9a, 0x92, 0x0b, 0x9b, 0x73, 0xfa, 0xb8, 0x64,
-  0x6d, 0x72, 0x3d, 0xb4, 0xd5, 0x59, 0xa9, 0xc0, 0x91, 0xaf, 0x2a, 0x59,
-  0x02, 0x95, 0x50, 0xcc, 0x39, 0xce, 0x13, 0x75, 0xf6, 0x19, 0x51, 0xe6,
-  0xd1, 0xc9, 0xba, 0x23, 0x3d, 0x31, 0x1b, 0x00, 0xff, 0xda, 0x80, 0x88,
-  0x32, 0x67, 0xb0, 0x0b, 0x2a, 0x67, 0x6f, 0x13, 0xa8, 0x74, 0x21, 0x4a,
-  0xc7, 0x2a, 0xfd, 0x8f, 0xa1, 0x28, 0x6f, 0x68, 0x51, 0x9f, 0x65, 0xef,
-  0x8c, 0xbe, 0x3e, 0xdd, 0x20, 0xc4, 0x5e, 0x1d, 0x74, 0x16, 0xcb, 0x2f,
-  0x83, 0x56, 0x0d, 0xe5, 0x48, 0xc7, 0xf9, 0xe4, 0xce, 0x20, 0x0f, 0x0a,
-  0xf6, 0x9e, 0xf4, 0x89, 0x68, 0xb7, 0x10, 0x1b, 0x20, 0x7a, 0xa4, 0x09,
-  0xaa, 0x9c, 0xc1, 0x3e, 0xa8, 0x98, 0xbd, 0x4d, 0x60, 0x95, 0x0b, 0x09,
-  0x5b, 0x8b, 0xd2, 0xb1, 0xc2, 0x28, 0x18, 0x33, 0x3f, 0x39, 0x3b, 0xba,
-  0x99, 0xc9, 0xc8, 0xde, 0x91, 0xbe, 0xbe, 0x8f, 0x36, 0x08, 0x37, 0x46,
-  0x3c, 0xf1, 0x41, 0x67, 0x01, 0x58, 0x68, 0x53, 0xfb, 0x64, 0xe5, 0x50,
-  0x7c, 0x36, 0xe1, 0xdc, 0x12, 0xe9, 0x40, 0xa4, 0x2f, 0x9c, 0xf3, 0xcb,
-  0x08, 0x0c, 0x37, 0x4d, 0x70, 0x6e, 0x05, 0x8c, 0xbd, 0xe1, 0x3f, 0x2b,
-  0x0f, 0x71, 0x67, 0x60, 0x7d, 0x1d, 0xed, 0x83, 0x8a, 0xd9, 0xdb, 0x04,
-  0x96, 0x61, 0x1d, 0x3b, 0x04, 0xc2, 0x29, 0x1d, 0x2b, 0xd0, 0x48, 0x19,
-  0x8a, 0xa7, 0xc6, 0x72, 0xbf, 0xcd, 0xdd, 0x7d, 0x3c, 0xd2, 0x67, 0xa2,
-  0x9c, 0x4f, 0x92, 0x9a, 0x38, 0x14, 0x7e, 0x70, 0x97, 0x8b, 0x15, 0x85,
-  0x96, 0x1b, 0x93, 0x6b, 0xb9, 0xa9, 0x1d, 0x93, 0x52, 0x28, 0x98, 0x26,
-  0x70, 0xdf, 0xc4, 0x42, 0x37, 0x20, 0x4d, 0x62, 0x9e, 0x79, 0x4f, 0x12,
-  0x6e, 0x3c, 0x51, 0x00, 0x5c, 0xea, 0x06, 0x4e, 0x49, 0xff, 0xd7, 0xdc,
-  0xcc, 0xcd, 0x0a, 0x7f, 0x19, 0x67, 0xe0, 0x07, 0x70, 0x1a, 0x54, 0xc2,
-  0x5e, 0x18, 0x58, 0x88, 0x75, 0xec, 0x10, 0x90, 0xc9, 0x95, 0xa4, 0xd7,
-  0x05, 0x4c, 0x38, 0x79, 0xf5, 0x0d, 0xa8, 0xdd, 0x16, 0x90, 0xbe, 0xa7,
-  0x8f, 0xce, 0x82, 0xf3, 0x09, 0xa7, 0xed, 0xd6, 0xf2, 0x18, 0x71, 0xe5,
-  0x48, 0xb5, 0xde, 0x4b, 0xf9, 0xdd, 0xf9, 0x45, 0x3b, 0xc8, 0x9b, 0xab,
-  0x62, 0x28, 0x20, 0xb2, 0x27, 0xbe, 0x00, 0x4c, 0x72, 0x4e, 0x33, 0xff,
-  0x10, 0x38, 0xc8, 0x25, 0x52, 0x23, 0x98, 0xa2, 0x97, 0x87, 0x03, 0xbd,
-  0x19, 0xe3, 0xe6, 0xf3, 0xc4, 0x19, 0x50, 0x46, 0x61, 0xea, 0xf4, 0x1b,
-  0x67, 0x70, 0x16, 0x54, 0xc4, 0x5e, 0x10, 0x78, 0xc4, 0x5a, 0xa0, 0x8e,
-  0x2e, 0x24, 0xec, 0x10, 0x14, 0x78, 0x92, 0x2b, 0x56, 0x96, 0x29, 0x69,
-  0xd2, 0xa9, 0x9b, 0x63, 0x65, 0xcc, 0x7c, 0x59, 0xf8, 0x37, 0x02, 0xc9,
-  0x91, 0x6e, 0x2e, 0x5b, 0xfa, 0xfc, 0xf5, 0x9e, 0x26, 0x15, 0x72, 0x61,
-  0x69, 0xfc, 0x38, 0x14, 0x70, 0x32, 0xcb, 0xef, 0xd3, 0xf4, 0xf4, 0x6e,
-  0x0e, 0x93, 0xfe, 0x91, 0x20, 0xbd, 0x14, 0x4a, 0x80, 0x26, 0xaa, 0x65,
-  0x2b, 0xfd, 0x0f, 0x46, 0x79, 0x8f, 0xb3, 0x07, 0xbe, 0x44, 0xeb, 0xe6,
-  0x22, 0x46, 0xfa, 0x44, 0xd3, 0x69, 0xe4, 0x9b, 0x92, 0xfb, 0x1b, 0x67,
-  0x40, 0x27, 0xe1, 0xd4, 0x31, 0x3c, 0x47, 0x1f, 0x92, 0x57, 0x4b, 0x10,
-  0x2c, 0x41, 0x2b, 0x7b, 0x7c, 0xbb, 0x8b, 0xb2, 0x95, 0x83, 0x36, 0xec,
-  0x05, 0x68, 0x47, 0xac, 0x05, 0x6a, 0x83, 0xb5, 0xef, 0x10, 0x3c, 0x11,
-  0x9b, 0xbc, 0x1c, 0xa9, 0xc2, 0x28, 0x50, 0x72, 0x25, 0x41, 0x3a, 0x9f,
-  0x97, 0x50, 0xa4, 0x39, 0x32, 0x05, 0x25, 0x2f, 0xd2, 0x87, 0xf4, 0xf1,
-  0x35, 0x7d, 0x4c, 0x10, 0xd9, 0x29, 0xa1, 0x9c, 0x5a, 0x49, 0x97, 0x87,
-  0xf1, 0x45, 0x4d, 0x24, 0xe9, 0x32, 0x3b, 0xe2, 0x65, 0x50, 0x1e, 0x88,
-  0x08, 0x36, 0x20, 0x12, 0x4f, 0x77, 0x64, 0x09, 0x46, 0x2e, 0x11, 0xe7,
-  0x18, 0x2f, 0x2e, 0x96, 0xd3, 0x74, 0x53, 0xc2, 0x18, 0x29, 0x1e, 0xcf,
-  0x43, 0xe8, 0x0c, 0x5c, 0x75, 0x58, 0x9e, 0x24, 0x1c, 0xb2, 0x4b, 0x8e,
-  0x5d, 0x90, 0xe1, 0x4f, 0x2c, 0xec, 0x05, 0x25, 0xcb, 0xd8, 0x70, 0x40,
-  0x3b, 0xc3, 0x0a, 0xa0, 0x02, 0xac, 0x43, 0x87, 0xb0, 0xfb, 0xbc, 0x1c,
-  0x5d, 0xa0, 0xab, 0xdd, 0x78, 0xe9, 0xf6, 0xd2, 0xf1, 0xa4, 0x02, 0xac,
-  0x29, 0x2b, 0x74, 0xc7, 0xc4, 0x42, 0x1f, 0xec, 0x2e, 0x69, 0x27, 0x1f,
-  0x3c, 0x34, 0x9a, 0x19, 0x49, 0xcb, 0xd9, 0xbd, 0x44, 0xdd, 0x2f, 0x32,
-  0x9b, 0x27, 0x3d, 0x0f, 0xc5, 0x6e, 0x04, 0x81, 0x2c, 0x65, 0x3f, 0x9e,
-  0xb6, 0x6d, 0x5b, 0x72, 0x0d, 0xf7, 0xde, 0x98, 0xe5, 0x12, 0x31, 0x90,
-  0x2f, 0xf0, 0x74, 0xa0, 0xcc, 0x83, 0x95, 0xd5, 0x04, 0xab, 0xac, 0x0d,
-  0x9d, 0xc1, 0xe8, 0xab, 0xc3, 0xc8, 0x94, 0x8a, 0x1d, 0x5c, 0x82, 0xac,
-  0x04, 0x59, 0x69, 0x33, 0x0b, 0x7b, 0xbb, 0x92, 0x0d, 0x48, 0x5f, 0x02,
-  0x4f, 0xb0, 0x02, 0x28, 0xb3, 0x62, 0x85, 0x1d, 0xc2, 0x5a, 0x97, 0x63,
-  0x9b, 0xbc, 0x5c, 0x02, 0x25, 0x2f, 0x6d, 0x82, 0x74, 0xeb, 0x67, 0x84,
-  0xb1, 0x4b, 0x14, 0xfd, 0x22, 0x3f, 0x06, 0x61, 0xa1, 0x4f, 0x1a, 0x44,
-  0xa4, 0x6b, 0xd2, 0x9d, 0x20, 0x3c, 0x1c, 0xe9, 0xe0, 0xec, 0xb4, 0xeb,
-  0xee, 0x4e, 0xf4, 0xa7, 0x54, 0x9e, 0x15, 0x42, 0x39, 0x20, 0xfa, 0x13,
-  0x19, 0xef, 0x06, 0x3a, 0x3a, 0x3c, 0xe8, 0xaf, 0xc2, 0xfa, 0x87, 0x2b,
-  0xc5, 0x09, 0xe2, 0xab, 0x5e, 0xb1, 0x34, 0xee, 0x08, 0x9d, 0x41, 0xef,
-  0xab, 0x83, 0xbe, 0x6c, 0xcd, 0x42, 0x84, 0x0f, 0xb2, 0x4b, 0x50, 0xc8,
-  0x9e, 0x2b, 0x59, 0x4a, 0x14, 0xbb, 0x21, 0x6f, 0x09, 0x3c, 0xc5, 0x0a,
-  0xa0, 0x4c, 0x80, 0xb5, 0x76, 0x08, 0xbb, 0x24, 0x66, 0x98, 0x97, 0x7e,
-  0x8c, 0x34, 0xc2, 0x29, 0x45, 0xfa, 0xb2, 0x6c, 0xb2, 0x5c, 0x07, 0x12,
-  0x52, 0x40, 0xba, 0x59, 0xe9, 0xeb, 0x61, 0x97, 0x8e, 0x47, 0xad, 0xb5,
-  0x54, 0x81, 0x34, 0x1f, 0x47, 0xd2, 0x59, 0x60, 0x52, 0x89, 0x56, 0x0a,
-  0x05, 0x5c, 0xe9, 0xbc, 0x56, 0x80, 0xee, 0x9d, 0x8e, 0x81, 0xa9, 0xef,
-  0xfa, 0x4e, 0x16, 0x25, 0xcb, 0xe6, 0x65, 0xf2, 0xba, 0x64, 0x0e, 0xc4,
-  0x19, 0x88, 0x91, 0xdc, 0x92, 0xfe, 0xc1, 0x9d, 0x60, 0xb3, 0xf0, 0x13,
-  0xc5, 0xf6, 0x05, 0x1b, 0xb0, 0xb7, 0x68, 0xe7, 0x36, 0x51, 0xd6, 0x30,
-  0x7b, 0x8e, 0x75, 0x80, 0x3a, 0x74, 0x88, 0xf3, 0xbc, 0x5c, 0xb2, 0x85,
-  0xe1, 0xa2, 0x73, 0x2a, 0xbb, 0x09, 0x6e, 0xfd, 0xfa, 0xc1, 0xb4, 0x17,
-  0x14, 0x3a, 0x26, 0xe0, 0xca, 0x44, 0xdf, 0x9b, 0x64, 0x83, 0x10, 0x0f,
-  0x6a, 0x97, 0x0e, 0xe6, 0x37, 0x8b, 0x97, 0x4a, 0x17, 0x8f, 0x03, 0x0f,
-  0x43, 0xad, 0x8c, 0xc2, 0xbb, 0x90, 0xde, 0xd2, 0xd3, 0x44, 0x03, 0x92,
-  0x9f, 0x7f, 0x6b, 0x71, 0xc7, 0xfa, 0x9a, 0xfb, 0xeb, 0x88, 0xdd, 0x7a,
-  0x96, 0xe7, 0x68, 0xdb, 0x9c, 0x16, 0xd6, 0x8d, 0x0f, 0x8a, 0xb1, 0x77,
-  0xf0, 0x53, 0xe7, 0x58, 0x71, 0x28, 0xe9, 0x10, 0x4b, 0xb2, 0x6c, 0xf3,
-  0xb2, 0xef, 0x97, 0xb6, 0x63, 0x52, 0xa4, 0x53, 0xf5, 0x91, 0xdf, 0x71,
-  0x06, 0xd3, 0x96, 0x28, 0x3a, 0x3b, 0x61, 0x3f, 0xc0, 0x91, 0x1c, 0x54,
-  0xb2, 0x41, 0xc8, 0xa9, 0x5d, 0xe3, 0x23, 0x2c, 0xd7, 0x9f, 0x1c, 0xe9,
-  0x56, 0x5a, 0x2f, 0x3c, 0x03, 0xca, 0x23, 0x12, 0xe3, 0xef, 0x5d, 0x47,
-  0xca, 0xde, 0x0d, 0xf8, 0xdf, 0xd4, 0xe8, 0x0b, 0x7f, 0xa6, 0xa2, 0x34,
-  0x62, 0x57, 0xb1, 0xf2, 0xe4, 0xd6, 0x3a, 0x64, 0x58, 0x56, 0x00, 0xdb,
-  0xcc, 0x13, 0x1e, 0x82, 0x20, 0x4f, 0xde, 0x2a, 0x9d, 0x67, 0x9b, 0x81,
-  0x09, 0x2c, 0x88, 0x41, 0xad, 0x2d, 0x62, 0xf9, 0x7a, 0x70, 0xdf, 0x45,
-  0x0a, 0xd8, 0xc1, 0xc5, 0xa6, 0x09, 0x8c, 0xdb, 0xbf, 0xbd, 0x1b, 0xa9,
-  0x86, 0xfc, 0x53, 0x64, 0x4e, 0x3e, 0xfd, 0xf8, 0xc4, 0x4d, 0x7f, 0x24,
-  0x1b, 0x84, 0xdb, 0xe6, 0x63, 0xdf, 0xc6, 0x58, 0x86, 0x85, 0xae, 0xf3,
-  0x3b, 0x13, 0x1f, 0x36, 0xda, 0x26, 0x6a, 0xa1, 0x1c, 0xe9, 0x5d, 0xc7,
-  0x05, 0x7e, 0x61, 0x79, 0x17, 0xd6, 0x8b, 0x7f, 0x90, 0x26, 0x04, 0xb5,
-  0xb5, 0xcc, 0x8e, 0x1f, 0x31, 0x5d, 0xca, 0xc7, 0xc7, 0x71, 0x14, 0xb0,
-  0x29, 0x48, 0xc7, 0x9e, 0x2f, 0xd9, 0x18, 0x7b, 0x19, 0xac, 0x08, 0x54,
-  0x90, 0x2c, 0xc7, 0xbc, 0x5c, 0xf6, 0x04, 0xe2, 0xa2, 0x0e, 0x34, 0x29,
-  0xeb, 0x31, 0xb4, 0x45, 0x5d, 0x90, 0x37, 0x1b, 0x69, 0x80, 0x46, 0xcc,
-  0x08, 0x75, 0xaf, 0x8f, 0xf4, 0x2b, 0xdf, 0xc6, 0xe9, 0xcf, 0x8a, 0x46,
-  0x6a, 0xeb, 0x16, 0xb7, 0x89, 0x45, 0x62, 0x3d, 0x14, 0x47, 0x09, 0xd3,
-  0x7c, 0xfe, 0x0b, 0xfd, 0xe7, 0x3b, 0x66, 0x41, 0x5b, 0xfc, 0xc3, 0x5a,
-  0x97, 0x49, 0xc0, 0xd9, 0x11, 0x37, 0xb8, 0x8e, 0xd8, 0xfb, 0xb6, 0x83,
-  0x20, 0x05, 0x33, 0xb7, 0x63, 0x8f, 0xb3, 0xf5, 0x9c, 0xbd, 0x1c, 0xd6,
-  0x39, 0xd4, 0x36, 0x59, 0xa2, 0x79, 0x19, 0x27, 0xdd, 0xf9, 0x5c, 0x3a,
-  0x48, 0x04, 0xa1, 0xb0, 0x03, 0x9a, 0x16, 0x07, 0x78, 0xc7, 0xe5, 0x88,
-  0x64, 0x95, 0xc9, 0xfe, 0xd4, 0x3a, 0x23, 0x8b, 0x67, 0xb9, 0x30, 0x51,
-  0x5c, 0x42, 0x73, 0xcb, 0x6e, 0x03, 0xcf, 0x83, 0xa2, 0xa3, 0xe5, 0xea,
-  0x96, 0xcb, 0xf1, 0x95, 0xde, 0x56, 0xff, 0x28, 0xe8, 0x70, 0x72, 0x06,
-  0x71, 0x86, 0xb2, 0xca, 0x34, 0xf1, 0x2d, 0xfc, 0x4a, 0xf6, 0x32, 0x58,
-  0x71, 0xa8, 0xc5, 0xbe, 0x44, 0xf3, 0x32, 0x86, 0xe6, 0x39, 0xef, 0x70,
-  0x92, 0x06, 0x5f, 0x1b, 0x25, 0xa4, 0x1b, 0xa0, 0x30, 0x5a, 0x63, 0x4b,
-  0xd3, 0x82, 0x92, 0xea, 0xe1, 0x4b, 0x03, 0x70, 0x9c, 0x63, 0x86, 0x35,
-  0xe2, 0x49, 0x6c, 0xc2, 0x46, 0x68, 0xa0, 0x64, 0x0a, 0xbb, 0xf7, 0xd6,
-  0xf5, 0x12, 0x37, 0x87, 0xd5, 0xa4, 0x2f, 0x0b, 0x3f, 0xb1, 0x83, 0x6c,
-  0x13, 0x5a, 0x58, 0x9f, 0x61, 0x78, 0x0e, 0x7b, 0x69, 0xac, 0xdc, 0x7a,
-  0x23, 0x95, 0x97, 0x91, 0x45, 0x4e, 0xdb, 0x75, 0x7e, 0x39, 0xeb, 0x17,
-  0x39, 0x50, 0xd8, 0xff, 0xb8, 0x74, 0x44, 0xaa, 0x4c, 0x4d, 0xdf, 0x94,
-  0x66, 0xfb, 0x4e, 0x49, 0x46, 0xcb, 0x67, 0xb1, 0x78, 0xf0, 0x6c, 0x28,
-  0xc4, 0x01, 0x4a, 0x65, 0x9e, 0x80, 0xee, 0x7d, 0xd0, 0x90, 0xbe, 0xac,
-  0xfb, 0xf0, 0xa0, 0x89, 0xe2, 0xe6, 0x94, 0x9d, 0x9f, 0x73, 0xf6, 0x20,
-  0xc3, 0x9e, 0x0e, 0x2b, 0x9b, 0x97, 0xe7, 0x33, 0x43, 0x9f, 0x77, 0x0b,
-  0x1a, 0xa7, 0x7c, 0x50, 0x58, 0x04, 0x4b, 0xd3, 0x2a, 0xda, 0xcb, 0x59,
-  0xc3, 0x64, 0x64, 0x72, 0x49, 0x50, 0xb2, 0x01, 0xa8, 0x82, 0xa2, 0x95,
-  0x28, 0x66, 0x95, 0xbb, 0xf1, 0x52, 0x75, 0x69, 0xeb, 0x29, 0xde, 0x7d,
-  0x1d, 0x80, 0xb3, 0x83, 0x05, 0xce, 0x20, 0xc2, 0x1e, 0xfc, 0x0c, 0x2c,
-  0x55, 0xae, 0x80, 0x6b, 0xed, 0xae, 0xf1, 0x76, 0xe5, 0x76, 0x87, 0x5a,
-  0x04, 0x11, 0xe8, 0xee, 0xf3, 0x14, 0xcf, 0xa3, 0x74, 0xa0, 0xce, 0xd5,
-  0x1d, 0xef, 0x57, 0xe4, 0x39, 0x57, 0x41, 0xd1, 0xb2, 0xc4, 0x3f, 0x54,
-  0x05, 0x5c, 0xe8, 0x43, 0x2d, 0xe9, 0x9d, 0x5f, 0xf7, 0xb9, 0xb9, 0x2a,
-  0x71, 0x06, 0xa7, 0xec, 0xf1, 0xda, 0xf1, 0xf9, 0x58, 0xaa, 0x5c, 0x01,
-  0x90, 0xce, 0xe0, 0x3d, 0x20, 0x93, 0x8e, 0xb3, 0x5b, 0x34, 0x21, 0x78,
-  0x66, 0x82, 0x80, 0x9a, 0xdf, 0x8d, 0x02, 0x5d, 0x27, 0x6e, 0x91, 0xf2,
-  0x0c, 0xdc, 0x6e, 0x79, 0x5c, 0xe6, 0x1e, 0x81, 0x62, 0xe7, 0xe8, 0x6f,
-  0x29, 0x03, 0x69, 0xc9, 0x30, 0xb4, 0xd5, 0xa4, 0xfb, 0x75, 0xdf, 0xe5,
-  0x12, 0x38, 0x83, 0x64, 0xee, 0x9c, 0xb0, 0x57, 0x42, 0x9f, 0x0a, 0x4b,
-  0x93, 0x2b, 0xf8, 0x99, 0x2e, 0x9c, 0x0a, 0x60, 0xc7, 0x5b, 0x66, 0xe0,
-  0x81, 0x3c, 0xc0, 0xe0, 0x52, 0xac, 0xb8, 0x5d, 0xb6, 0x92, 0xf6, 0x6d,
-  0xeb, 0xf8, 0x93, 0x05, 0x25, 0x3c, 0x1f, 0x4a, 0xfa, 0x3b, 0xdb, 0x05,
-  0xe3, 0x49, 0xef, 0xb2, 0xe5, 0x96, 0x58, 0xf7, 0x85, 0x9d, 0x34, 0xd9,
-  0x31, 0x56, 0xf6, 0x60, 0x65, 0x4f, 0xe8, 0x83, 0x67, 0x63, 0xc9, 0xdc,
-  0xac, 0xa9, 0x92, 0xc9, 0x15, 0x79, 0x74, 0x68, 0xe0, 0xf6, 0x1e, 0xec,
-  0x25, 0x4a, 0x4c, 0x5b, 0xe2, 0x1f, 0x3a, 0xfe, 0x30, 0xf9, 0x87, 0x72,
-  0xce, 0x89, 0x3b, 0x8e, 0x80, 0xb6, 0xf5, 0x0f, 0xd3, 0x98, 0xac, 0x4c,
-  0x2b, 0xa0, 0xd6, 0x5d, 0x40, 0x29, 0x75, 0x42, 0xa6, 0x09, 0xac, 0xb4,
-  0x72, 0x10, 0xae, 0xfb, 0x24, 0x75, 0xde, 0xb3, 0x2d, 0x83, 0xd9, 0xe3,
-  0xad, 0x20, 0xf9, 0xd0, 0x7a, 0x13, 0x20, 0x09, 0xae, 0xc2, 0x92, 0xa8,
-  0x80, 0x74, 0x01, 0xeb, 0xce, 0x3c, 0x04, 0xf0, 0xa3, 0x55, 0xec, 0xef,
-  0x36, 0xaa, 0x8f, 0x95, 0x38, 0xb8, 0x0e, 0x0f, 0x45, 0xa4, 0x3b, 0x47,
-  0x50, 0xb6, 0xd9, 0xc1, 0x68, 0xbc, 0x13, 0x40, 0x5b, 0xa3, 0x6e, 0x52,
-  0x4a, 0x7e, 0xe9, 0x41, 0x1d, 0x54, 0x70, 0x17, 0x29, 0x78, 0xa8, 0x89,
-  0xfa, 0xcb, 0x30, 0x54, 0xaa, 0x7a, 0xb8, 0xec, 0x93, 0xbf, 0xb7, 0x05,
-  0xd9, 0xc3, 0x2b, 0xa2, 0x76, 0xdd, 0xf5, 0x05, 0x5e, 0x0d, 0x53, 0x54,
-  0x26, 0x57, 0x14, 0x58, 0xbb, 0x20, 0xbc, 0x4e, 0x3f, 0x55, 0x87, 0x28,
-  0xa0, 0x5b, 0x30, 0x46, 0x1e, 0xc6, 0x83, 0x50, 0xc2, 0x71, 0x91, 0x23,
-  0x8b, 0xa9, 0x02, 0x07, 0xe1, 0x1a, 0x17, 0x37, 0xeb, 0xdc, 0x4b, 0xdf,
-  0xc0, 0x4f, 0xb4, 0x80, 0x69, 0x69, 0x50, 0x8e, 0xf3, 0xa1, 0xb4, 0xd9,
-  0xd6, 0x41, 0x2d, 0x31, 0xd4, 0xdc, 0x79, 0xff, 0xda, 0x15, 0x4e, 0x87,
-  0x6d, 0xad, 0xf2, 0x37, 0x75, 0x85, 0xcb, 0x3e, 0xcf, 0x4c, 0x3e, 0x7b,
-  0x5c, 0x54, 0x17, 0x46, 0xf1, 0x46, 0x48, 0x5a, 0x16, 0x74, 0x58, 0xbb,
-  0xa0, 0x44, 0x14, 0x38, 0xc6, 0xdd, 0xe3, 0x32, 0x3b, 0x63, 0x40, 0x0b,
-  0x3d, 0x1c, 0xb2, 0xc9, 0x0a, 0xf4, 0xf0, 0xee, 0x5a, 0x17, 0xf9, 0x6a,
-  0x93, 0xd9, 0xcb, 0xe1, 0xe7, 0x56, 0x68, 0x8b, 0x90, 0x49, 0x97, 0xed,
-  0x81, 0xb6, 0x94, 0xf5, 0x0a, 0xa8, 0xc0, 0xb8, 0xdb, 0xe0, 0xa9, 0x72,
-  0x82, 0x85, 0xae, 0x9a, 0xf4, 0x60, 0xd9, 0xe7, 0xad, 0x6f, 0x36, 0x7b,
-  0x0e, 0x51, 0xae, 0xa1, 0x76, 0x99, 0x5f, 0x3e, 0xa3, 0xc2, 0xda, 0x07,
-  0xc5, 0xa3, 0x78, 0xb7, 0xc6, 0x3d, 0x3a, 0xb7, 0xff, 0x16, 0xce, 0xeb,
-  0xf0, 0xde, 0xd2, 0x3d, 0x7f, 0x93, 0xab, 0xa5, 0x96, 0x37, 0x74, 0x10,
-  0xb4, 0xcb, 0x92, 0x4e, 0x4f, 0x4a, 0xd1, 0x6d, 0x47, 0xc3, 0x57, 0x2e,
-  0xbb, 0xfd, 0xc3, 0xd0, 0x96, 0x15, 0x7b, 0x15, 0x94, 0x4b, 0x32, 0xb0,
-  0xb7, 0xdd, 0x1b, 0x08, 0xfc, 0x68, 0x85, 0xa9, 0xdd, 0x9e, 0x59, 0x97,
-  0x7d, 0x15, 0xd9, 0x23, 0xcf, 0x61, 0x9b, 0x4d, 0xaf, 0x2a, 0x8b, 0xaa,
-  0xc6, 0x82, 0xf2, 0x28, 0xf0, 0xb4, 0xdb, 0x23, 0xe9, 0x2d, 0xc8, 0x33,
-  0x3a, 0xb9, 0xb9, 0x05, 0xd6, 0x66, 0xb6, 0x8e, 0xfc, 0x60, 0x7d, 0xce,
-  0x49, 0xcb, 0xb3, 0x1e, 0x82, 0xe7, 0xb7, 0x91, 0x0a, 0xd7, 0x60, 0x35,
-  0x50, 0x81, 0x87, 0xd8, 0x5f, 0x31, 0xe3, 0x9b, 0x4a, 0xd2, 0xf7, 0x33,
-  0x51, 0x92, 0x3d, 0x87, 0x28, 0xf0, 0x51, 0xc9, 0x27, 0xd1, 0x9f, 0x83,
-  0x95, 0x88, 0x72, 0xaf, 0x19, 0x18, 0x73, 0x9e, 0x0f, 0xb6, 0x84, 0x74,
-  0xde, 0x10, 0x78, 0xc7, 0xe2, 0xb3, 0x59, 0x26, 0xfc, 0x59, 0xd7, 0xdb,
-  0xc6, 0xa2, 0x71, 0xb6, 0x68, 0xb7, 0xa5, 0x0a, 0x2a, 0x31, 0x39, 0xcc,
-  0x7a, 0x65, 0x7f, 0xb7, 0x76, 0xff, 0xd4, 0xb9, 0x5c, 0x49, 0xea, 0xed,
-  0x91, 0x78, 0x54, 0xf2, 0x05, 0xa5, 0x7a, 0x2c, 0x80, 0xda, 0xa8, 0xc8,
-  0xe6, 0xac, 0xe3, 0x3c, 0xfb, 0x8e, 0x8b, 0xcb, 0x9a, 0xce, 0x39, 0xa6,
-  0x42, 0x03, 0x1f, 0x56, 0x6f, 0x2b, 0xaf, 0x83, 0x14, 0x5a, 0xf1, 0x0a,
-  0xa8, 0x88, 0xc2, 0xe4, 0xdf, 0xd6, 0x3a, 0x01, 0x5d, 0x96, 0x7d, 0x72,
-  0xb8, 0x06, 0x39, 0xc5, 0xde, 0x19, 0xca, 0x44, 0x4d, 0xaa, 0xa8, 0x2a,
-  0x2c, 0xc8, 0x44, 0x9d, 0x9e, 0xc8, 0x16, 0x45, 0x2c, 0xd9, 0xe4, 0x9e,
-  0x11, 0x00, 0x45, 0xe5, 0x89, 0x1a, 0x41, 0x41, 0xb9, 0x3d, 0x06, 0xe5,
-  0x49, 0x9f, 0x6a, 0x48, 0x07, 0x19, 0x9e, 0xdd, 0xbe, 0x40, 0x45, 0xad,
-  0xc9, 0x3d, 0x9e, 0x7a, 0x5e, 0x48, 0xc6, 0xb8, 0x49, 0xb7, 0xf6, 0x2c,
-  0xea, 0x16, 0x8f, 0xd2, 0x61, 0x1d, 0xa3, 0x4c, 0x3a, 0x2a, 0xe2, 0xb8,
-  0xe8, 0x7d, 0x94, 0x6c, 0x6f, 0x37, 0x02, 0x49, 0x0f, 0x17, 0xdf, 0xcc,
-  0x74, 0xab, 0xfe, 0xa5, 0xc5, 0xc0, 0x2b, 0x08, 0x63, 0x4d, 0x96, 0xf4,
-  0x87, 0xa1, 0xd6, 0x42, 0xa7, 0xbb, 0x3b, 0xc5, 0xa4, 0xdb, 0x1b, 0x99,
-  0x41, 0x6b, 0x97, 0x65, 0xdf, 0xf2, 0x55, 0x3c, 0xc9, 0xed, 0x16, 0xa1,
-  0xcf, 0x47, 0x51, 0x11, 0x5e, 0x8e, 0x51, 0xe6, 0x67, 0x60, 0x6d, 0x54,
-  0x23, 0x17, 0x75, 0x3e, 0x37, 0xb7, 0x1b, 0xdc, 0x6e, 0x59, 0xd2, 0x2d,
-  0xe5, 0xa1, 0x3c, 0xfa, 0xa9, 0xfa, 0xc5, 0xe4, 0x20, 0xf1, 0xa6, 0xa0,
-  0xd0, 0x1f, 0x85, 0x5a, 0x7a, 0xde, 0x64, 0xa6, 0x69, 0xaa, 0x6a, 0xef,
-  0x70, 0x66, 0x08, 0xed, 0xed, 0x16, 0x37, 0x84, 0xe7, 0x8f, 0xdb, 0x2e,
-  0x51, 0x3f, 0x05, 0x0b, 0xc2, 0x54, 0xc9, 0x46, 0x15, 0x0f, 0x3a, 0x85,
-  0x77, 0xd1, 0xb1, 0x50, 0x1c, 0xfe, 0x30, 0x94, 0xec, 0x0e, 0x2d, 0x3d,
-  0xef, 0xf2, 0xe8, 0xa1, 0x1b, 0xc8, 0xef, 0x1f, 0xf5, 0xe5, 0x0e, 0xe0,
-  0x9e, 0x87, 0x15, 0x70, 0x7b, 0xcd, 0xc5, 0x5f, 0xc4, 0x7a, 0x75, 0xcf,
-  0x7b, 0x1d, 0x5f, 0x82, 0xf6, 0x5c, 0xcf, 0x6b, 0x14, 0xc7, 0x2b, 0xea,
-  0x4f, 0x8b, 0x7a, 0x1d, 0xaf, 0xe3, 0x75, 0x7c, 0xa9, 0xe3, 0x55, 0xd5,
-  0x5f, 0x99, 0xdc, 0x48, 0xd3, 0x6e, 0x7e, 0x6a, 0x82, 0x34, 0xd9, 0xb8,
-  0xe6, 0x6c, 0xa8, 0xbb, 0xef, 0xa5, 0x3e, 0x13, 0x3b, 0x57, 0x93, 0xf6,
-  0x27, 0x9b, 0x8f, 0xc8, 0x57, 0xb6, 0xc2, 0x16, 0x8c, 0xfc, 0x4f, 0x96,
-  0xbb, 0xe6, 0xb1, 0x94, 0xa1, 0x69, 0xf9, 0x35, 0xa4, 0x5f, 0x0a, 0x48,
-  0xbf, 0x3c, 0x40, 0xfa, 0x21, 0x6f, 0x1a, 0xfe, 0xb7, 0x89, 0x8e, 0xfc,
-  0x8f, 0x26, 0xdd, 0x5d, 0x1c, 0xff, 0x87, 0x4b, 0xeb, 0x66, 0xf9, 0xda,
-  0xf2, 0xa5, 0xf8, 0x54, 0x35, 0x3f, 0x21, 0xdd, 0x7e, 0x07, 0xd2, 0x2f,
-  0x51, 0xd2, 0x2f, 0x5f, 0x86, 0x74, 0xf7, 0xbf, 0x95, 0x48, 0x36, 0xf9,
-  0x19, 0x5a, 0x83, 0xac, 0x68, 0x82, 0x14, 0xd9, 0x74, 0x44, 0xdf, 0x24,
-  0x97, 0x3c, 0x72, 0x6d, 0xf4, 0x10, 0x75, 0xf2, 0x79, 0x19, 0x43, 0x90,
-  0x5c, 0xc1, 0x27, 0x37, 0xb8, 0x21, 0x11, 0xbb, 0x91, 0x34, 0x51, 0x94,
-  0xb3, 0xb3, 0x5d, 0x9a, 0x30, 0x95, 0x9b, 0x6d, 0xce, 0x07, 0x25, 0x71,
-  0x82, 0xf5, 0xe7, 0xb4, 0xf6, 0x04, 0xe9, 0x97, 0x42, 0xd2, 0x37, 0x67,
-  0xd9, 0xd7, 0xff, 0xe6, 0x2b, 0x4d, 0x73, 0xfc, 0xda, 0xae, 0x9a, 0x9a,
-  0x93, 0x91, 0x5d, 0x0e, 0xff, 0x5e, 0x22, 0xe3, 0x6b, 0x4e, 0x63, 0x8f,
-  0x9f, 0x3c, 0x6b, 0xdd, 0x32, 0xc2, 0xc3, 0x85, 0x1c, 0xce, 0x9f, 0x1e,
-  0xff, 0x9f, 0x43, 0x7a, 0xf3, 0x04, 0xd2, 0x83, 0x9a, 0x6a, 0x76, 0x35,
-  0xb5, 0x92, 0x7e, 0x20, 0xf6, 0xb4, 0x33, 0x54, 0x91, 0x7e, 0x30, 0x5a,
-  0x27, 0x74, 0x2f, 0xde, 0x63, 0x1b, 0xbb, 0xf7, 0xb1, 0xeb, 0xd9, 0xb6,
-  0x6c, 0x27, 0x48, 0x3f, 0x8e, 0xff, 0x0f, 0x31, 0xef, 0x4d, 0xb3, 0x99,
-  0x9e, 0x3d, 0x51, 0x25, 0x9a, 0xde, 0x6c, 0x26, 0xa6, 0x89, 0x48, 0xc8,
-  0x09, 0xe9, 0x11, 0xb5, 0xdc, 0x11, 0xd7, 0xa4, 0x2b, 0x3d, 0x32, 0x9e,
-  0x26, 0xd9, 0x7f, 0x9a, 0xe6, 0xe0, 0x10, 0x9a, 0xdd, 0x69, 0x9b, 0xc8,
-  0x28, 0x73, 0xe3, 0xff, 0x12, 0x5e, 0xbe, 0x84, 0xf4, 0x4b, 0x28, 0x92,
-  0x31, 0xf1, 0x6c, 0x36, 0xeb, 0xc4, 0x66, 0x17, 0x15, 0x7e, 0x3e, 0xac,
-  0xc4, 0xc5, 0x63, 0x66, 0x35, 0x7d, 0xeb, 0x13, 0x2e, 0x49, 0x4d, 0x3f,
-  0xd7, 0xeb, 0x4b, 0xd8, 0x13, 0x9a, 0xe3, 0xaa, 0x76, 0x73, 0xb6, 0xcb,
-  0xc9, 0xf8, 0xff, 0x02, 0xd2, 0x5f, 0x9b, 0x3d, 0x5f, 0x73, 0x27, 0xee,
-  0x29, 0x59, 0xfc, 0x22, 0xfd, 0x95, 0x4c, 0xaf, 0xe3, 0x4f, 0x3d, 0xfe,
-  0x0f, 0xe5, 0xf3, 0x02, 0x98, 0xd6, 0x9e, 0x58, 0x27, 0x00, 0x00, 0x00,
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int possum_left_png_len = 4689;
-unsigned char possum_right_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x5a,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x79, 0x69, 0x54, 0x92, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
-  0x00, 0x4e, 0x50, 0x4c, 0x54, 0x45, 0x3e, 0xac, 0x7f, 0x00, 0x00, 0x00,
-  0x0d, 0x0d, 0x0d, 0x2d, 0x23, 0x1a, 0x28, 0x28, 0x28, 0x40, 0x40, 0x40,
-  0x56, 0x43, 0x32, 0x5c, 0x4f, 0x1d, 0x53, 0x53, 0x53, 0x64, 0x64, 0x64,
-  0x8d, 0x70, 0x5a, 0x97, 0x7d, 0x17, 0x7c, 0x7c, 0x7c, 0x88, 0x88, 0x88,
-  0xc6, 0xa3, 0x80, 0xaa, 0xaa, 0xaa, 0xc0, 0xa9, 0x8f, 0xd5, 0xb7, 0x0d,
-  0xf5, 0xc6, 0x05, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xf2, 0xbc, 0xa2,
-  0xf3, 0xd5, 0xbe, 0xf9, 0xdb, 0x73, 0xff, 0xf5, 0xc1, 0xff, 0xff, 0xff,
-  0x95, 0xfc, 0x8c, 0xb3, 0x00, 0x00, 0x00, 0x01, 0x74, 0x52, 0x4e, 0x53,
-  0x00, 0x40, 0xe6, 0xd8, 0x66, 0x00, 0x00, 0x00, 0x01, 0x62, 0x4b, 0x47,
-  0x44, 0x00, 0x88, 0x05, 0x1d, 0x48, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48,
-  0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01, 0x00,
-  0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07,
-  0xdd, 0x05, 0x1e, 0x0c, 0x06, 0x34, 0x64, 0xa6, 0xa0, 0xda, 0x00, 0x00,
-  0x11, 0x7c, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x5d, 0x89, 0x82,
-  0xa3, 0x38, 0x0e, 0x85, 0x08, 0x4c, 0x07, 0x2a, 0xcc, 0xb0, 0x5b, 0xa9,
-  0x64, 0xfe, 0xff, 0x47, 0x57, 0x87, 0x0d, 0x06, 0x8c, 0x0f, 0x91, 0xee,
-  0x9d, 0xae, 0x0e, 0xd3, 0x47, 0x4d, 0x35, 0xe2, 0x19, 0x3d, 0x49, 0x4f,
-  0x36, 0x26, 0x55, 0x55, 0xef, 0xe3, 0x1b, 0x1c, 0x1d, 0x1e, 0x6f, 0x2f,
-  0xfc, 0x69, 0x07, 0x3c, 0xa7, 0x37, 0xed, 0x7f, 0x20, 0xeb, 0x48, 0x3b,
-  0xfd, 0x0d, 0x6f, 0x5f, 0xfc, 0x41, 0xac, 0x3f, 0x98, 0x75, 0x98, 0xde,
-  0xac, 0xff, 0x3f, 0xc5, 0xef, 0xe7, 0x63, 0x75, 0xee, 0x58, 0x58, 0x87,
-  0x4e, 0xcb, 0xfa, 0xf7, 0x72, 0xcd, 0x79, 0xf1, 0x53, 0x8e, 0x51, 0x27,
-  0xb4, 0xf9, 0x60, 0x00, 0xd3, 0xe3, 0x89, 0xc7, 0x43, 0x60, 0xce, 0xb2,
-  0xfe, 0xb3, 0x87, 0x7b, 0x16, 0xeb, 0x44, 0xa4, 0xa8, 0xc4, 0x4f, 0xd9,
-  0x27, 0xe9, 0x84, 0xb6, 0x00, 0x0c, 0x40, 0x88, 0x27, 0xda, 0x3b, 0x62,
-  0xbd, 0x03, 0x2c, 0xf0, 0x1d, 0xfc, 0x42, 0xd7, 0x28, 0x7d, 0xa3, 0xc1,
-  0x3a, 0xd1, 0xad, 0xaa, 0xc4, 0x4f, 0xd9, 0x27, 0xe9, 0x84, 0xb6, 0x0c,
-  0x8c, 0x78, 0x47, 0xd6, 0x87, 0x0e, 0xba, 0xe1, 0xf9, 0xe8, 0x40, 0x9f,
-  0xea, 0xbf, 0x64, 0xb8, 0x67, 0xb0, 0xca, 0x90, 0xce, 0x8b, 0x5f, 0xfe,
-  0x18, 0x5f, 0x20, 0xb4, 0xd9, 0x60, 0x02, 0x44, 0xac, 0x3f, 0x1f, 0xc8,
-  0x3a, 0xda, 0xd1, 0x9f, 0x45, 0xa9, 0xfe, 0xeb, 0x87, 0x7b, 0x02, 0x8b,
-  0x6d, 0x20, 0x2f, 0x52, 0x94, 0xe2, 0xa7, 0x1a, 0xa3, 0x8f, 0xd5, 0x15,
-  0xdc, 0x9a, 0x02, 0x0c, 0x4f, 0x1e, 0xf0, 0x20, 0x23, 0xcb, 0xfa, 0xc0,
-  0x7f, 0x4e, 0x43, 0xbe, 0x1f, 0xb5, 0x7d, 0x81, 0xc6, 0x37, 0x3a, 0xac,
-  0x3d, 0x52, 0x6e, 0x31, 0xd3, 0x88, 0x9f, 0x96, 0x3e, 0x95, 0xd0, 0x16,
-  0x83, 0x11, 0xe3, 0xce, 0x64, 0x62, 0xd6, 0xb1, 0xb6, 0x0f, 0x64, 0x36,
-  0x50, 0xa9, 0xc7, 0x4b, 0x64, 0xd3, 0x7e, 0x72, 0xb8, 0x45, 0x19, 0x51,
-  0x8c, 0x15, 0x42, 0x62, 0xd6, 0x21, 0xf7, 0xee, 0x0a, 0xc5, 0x4f, 0xdf,
-  0x27, 0x29, 0x84, 0xb6, 0x04, 0x8c, 0x72, 0x9b, 0x5d, 0xe1, 0x0e, 0x24,
-  0x9e, 0x59, 0x9f, 0x88, 0xf9, 0xa1, 0xa3, 0x54, 0x2f, 0x6a, 0x91, 0x4e,
-  0x0e, 0x17, 0x0a, 0x7c, 0x53, 0x8c, 0xb5, 0x42, 0xea, 0x18, 0x89, 0x25,
-  0x2c, 0x53, 0x68, 0x35, 0xe2, 0x57, 0xee, 0x8f, 0x13, 0x42, 0x9b, 0x07,
-  0x46, 0x8c, 0xb3, 0x13, 0x26, 0x3a, 0xe1, 0xe1, 0xb1, 0x3e, 0x0c, 0xcf,
-  0x27, 0x92, 0xde, 0x20, 0xe9, 0x90, 0x2b, 0xec, 0x3f, 0x7d, 0xb8, 0xaf,
-  0xc0, 0x0a, 0x21, 0xa5, 0x69, 0x50, 0x89, 0x9f, 0x66, 0x8c, 0x1e, 0x96,
-  0x05, 0xcb, 0x14, 0xda, 0x6c, 0x30, 0x3a, 0xc9, 0x1e, 0x0c, 0x66, 0x69,
-  0xe7, 0x64, 0x40, 0xd2, 0x27, 0x4b, 0xfa, 0x90, 0xdb, 0xe2, 0xea, 0xfa,
-  0x02, 0x85, 0x6f, 0x94, 0x58, 0x87, 0x48, 0x09, 0xa8, 0x88, 0xf8, 0xc1,
-  0x2b, 0xe9, 0xdb, 0x62, 0x31, 0x98, 0x2f, 0xb4, 0x2f, 0x04, 0x13, 0xbe,
-  0x1f, 0x18, 0xfe, 0x16, 0x92, 0x53, 0x9d, 0x4d, 0x1b, 0x4a, 0x85, 0x0c,
-  0xd2, 0xf5, 0x7d, 0x41, 0x39, 0x7f, 0x5a, 0xac, 0x08, 0x52, 0x04, 0x6a,
-  0x27, 0x7e, 0xd3, 0x2c, 0x7e, 0x4c, 0x3a, 0xbc, 0x8a, 0xbe, 0x0c, 0xac,
-  0xd7, 0xc5, 0x0a, 0x59, 0x10, 0xe5, 0x16, 0x46, 0xbe, 0x90, 0x5f, 0xd3,
-  0xa5, 0xbd, 0x20, 0xe7, 0x19, 0xa9, 0xaa, 0xec, 0x0b, 0x52, 0xfc, 0x01,
-  0xbc, 0x0a, 0x4b, 0x13, 0x29, 0xbe, 0xf8, 0x4d, 0x01, 0xf1, 0x63, 0x8d,
-  0x80, 0xd7, 0xd0, 0x97, 0xc6, 0x82, 0x17, 0xc6, 0x0a, 0xf9, 0x62, 0x65,
-  0xe4, 0x6c, 0x2d, 0xe9, 0xe4, 0xc9, 0x44, 0xcd, 0x54, 0xf6, 0x05, 0x19,
-  0xfc, 0x6d, 0x13, 0x49, 0x89, 0xa5, 0x8b, 0x94, 0xbd, 0xf8, 0x59, 0xf5,
-  0x63, 0xf1, 0x13, 0xed, 0x83, 0xbd, 0xf6, 0xa9, 0xe8, 0x0b, 0x09, 0xad,
-  0x1d, 0xf1, 0x8c, 0x35, 0x04, 0x74, 0x56, 0x17, 0x2b, 0x14, 0xed, 0xa1,
-  0x83, 0x51, 0x1f, 0x97, 0xeb, 0x85, 0x39, 0xbf, 0xc4, 0x38, 0xd7, 0xf5,
-  0x05, 0x39, 0xfc, 0xc1, 0x66, 0xc4, 0x3a, 0xac, 0x93, 0xdd, 0xaa, 0x27,
-  0x7e, 0xc3, 0x1c, 0x3a, 0xc3, 0xa1, 0xf6, 0x69, 0xe9, 0xdb, 0x0b, 0xad,
-  0x43, 0x3b, 0xc6, 0xd2, 0x81, 0xb1, 0x3f, 0x30, 0x1a, 0xf0, 0x74, 0x2e,
-  0xec, 0x97, 0xcb, 0xc5, 0xc6, 0xcb, 0x65, 0xe2, 0x4c, 0xbf, 0x62, 0xa6,
-  0x03, 0x7e, 0x37, 0x43, 0xd4, 0xcb, 0xfa, 0x82, 0x2c, 0xfe, 0x20, 0xec,
-  0x9c, 0x32, 0xac, 0x73, 0xdd, 0xea, 0x46, 0xfc, 0x24, 0x7c, 0xe8, 0x57,
-  0x42, 0xfb, 0x4a, 0xe9, 0x0b, 0x61, 0x31, 0xda, 0x23, 0x8d, 0x55, 0x04,
-  0x26, 0x94, 0x63, 0x5d, 0x23, 0xce, 0x45, 0xef, 0x2e, 0x0d, 0x1e, 0xf4,
-  0x35, 0xb2, 0xff, 0xfc, 0xcf, 0x05, 0x49, 0xbf, 0x0c, 0x97, 0xe6, 0x92,
-  0x41, 0xb9, 0xae, 0x2f, 0x50, 0xf4, 0x90, 0x4a, 0x2c, 0x5d, 0xb7, 0x7a,
-  0x2c, 0x7e, 0x51, 0xed, 0x53, 0xd1, 0xa7, 0xc4, 0x2a, 0x04, 0x93, 0xf0,
-  0x67, 0xc9, 0x73, 0x60, 0xc2, 0x7a, 0x73, 0xa1, 0x9c, 0xff, 0xe7, 0x72,
-  0x69, 0x90, 0x74, 0xfc, 0x4e, 0x8a, 0x74, 0x6d, 0x5f, 0xa0, 0xe1, 0x4f,
-  0x87, 0xa5, 0x8d, 0x94, 0x63, 0xf1, 0xb3, 0xda, 0x07, 0x70, 0x79, 0x11,
-  0x7d, 0x47, 0x58, 0x4f, 0x1a, 0xb7, 0x60, 0x5d, 0x5e, 0x17, 0x97, 0xe8,
-  0x10, 0xef, 0x54, 0xe4, 0xf8, 0xfa, 0xf9, 0x79, 0xc5, 0xd3, 0x2f, 0x42,
-  0x3a, 0xc6, 0x40, 0x92, 0x73, 0x5d, 0x5f, 0xa0, 0xe1, 0x4f, 0x87, 0xa5,
-  0x8d, 0x14, 0x5f, 0xfc, 0x48, 0xf3, 0xb0, 0xee, 0xc9, 0x17, 0x93, 0xd3,
-  0xbe, 0x90, 0xf4, 0x69, 0xe8, 0xdb, 0x61, 0x3d, 0x67, 0xad, 0xbd, 0x4c,
-  0x33, 0x56, 0x81, 0xf3, 0x13, 0xb1, 0xc2, 0x7d, 0xce, 0xe3, 0x61, 0xbd,
-  0xc2, 0xac, 0x3f, 0x3f, 0xaf, 0x6d, 0x43, 0xa4, 0xb7, 0xe9, 0x44, 0x57,
-  0xf7, 0x05, 0x0a, 0xfe, 0x94, 0x58, 0xaa, 0x48, 0xd9, 0x8b, 0x9f, 0xd4,
-  0xc1, 0x61, 0x62, 0xf1, 0xb3, 0xda, 0xd7, 0xbc, 0x84, 0xbe, 0x00, 0x96,
-  0x43, 0x23, 0x6b, 0xa7, 0xb3, 0x55, 0xf5, 0xaa, 0x58, 0x61, 0xb3, 0x69,
-  0xc9, 0x04, 0xc2, 0x7a, 0x3e, 0xaf, 0x57, 0x24, 0xfb, 0xd2, 0x12, 0xe9,
-  0x97, 0x34, 0xe5, 0x8a, 0xbe, 0x40, 0xc1, 0x9f, 0x12, 0x4b, 0x19, 0x29,
-  0x01, 0xf1, 0xb3, 0x78, 0x2c, 0x7e, 0x4e, 0xfb, 0x5e, 0x42, 0x5f, 0x08,
-  0x0b, 0x63, 0x92, 0xcc, 0x2e, 0xc3, 0x8c, 0x75, 0x49, 0x3b, 0x3f, 0x33,
-  0x56, 0xaa, 0xee, 0xf1, 0x00, 0x29, 0x5a, 0x8f, 0xd9, 0x4a, 0x52, 0xbd,
-  0xb9, 0x70, 0xba, 0x27, 0x9f, 0x61, 0x28, 0xfa, 0x02, 0x37, 0x5c, 0x28,
-  0xe1, 0x4f, 0x85, 0x75, 0xb6, 0x5b, 0x5d, 0x89, 0x9f, 0x55, 0x3f, 0x11,
-  0x3f, 0xd1, 0xbe, 0xd7, 0xd0, 0x17, 0xc2, 0xb2, 0x60, 0xc7, 0x58, 0x7a,
-  0xb0, 0xee, 0xd1, 0xe1, 0xec, 0x75, 0x9a, 0xb0, 0xc3, 0x9f, 0x16, 0xb0,
-  0x4f, 0x21, 0x9d, 0x8e, 0xac, 0x67, 0x6c, 0xa5, 0x7d, 0xc1, 0x99, 0x1e,
-  0xb2, 0x0c, 0xeb, 0x6c, 0xb7, 0xba, 0x11, 0xbf, 0x01, 0xcb, 0xa0, 0xaf,
-  0x7d, 0x2f, 0xa2, 0x2f, 0x84, 0x65, 0xc1, 0x92, 0x58, 0xe5, 0x60, 0xf4,
-  0x00, 0x82, 0x16, 0x6e, 0x86, 0xe1, 0x39, 0x79, 0x55, 0xec, 0xf2, 0xf9,
-  0x49, 0xa4, 0x53, 0x41, 0x8c, 0x2c, 0x4d, 0x9f, 0xee, 0x0b, 0x54, 0x3d,
-  0xa4, 0x0a, 0x4b, 0xdb, 0xad, 0x06, 0xc4, 0x2f, 0x47, 0xfb, 0x54, 0xf4,
-  0x6d, 0xb1, 0x28, 0x67, 0x11, 0x2c, 0xa9, 0xb3, 0xa5, 0x60, 0x9c, 0x05,
-  0x98, 0xe8, 0x1d, 0x4c, 0x9c, 0xe8, 0xd3, 0xc7, 0xc7, 0x07, 0xfe, 0x8d,
-  0xb5, 0xe1, 0xf3, 0xda, 0x98, 0xbe, 0x67, 0xd6, 0x89, 0x76, 0x48, 0x72,
-  0xae, 0xe9, 0x0b, 0x34, 0xfc, 0xe9, 0xb0, 0xb4, 0xdd, 0xea, 0x22, 0x7e,
-  0xb3, 0x47, 0x33, 0xb4, 0x4f, 0x47, 0xdf, 0x16, 0x4b, 0xc0, 0x92, 0x3a,
-  0xab, 0x04, 0xa3, 0x65, 0x79, 0x11, 0xbc, 0x8f, 0x8f, 0x7f, 0xfe, 0x8b,
-  0xb4, 0x4f, 0xc8, 0xfa, 0xd5, 0x18, 0x64, 0xbd, 0x1f, 0xf8, 0x8a, 0xc6,
-  0x44, 0x69, 0x57, 0xf6, 0x05, 0x2a, 0xfe, 0x54, 0x58, 0xea, 0xa8, 0xdc,
-  0x89, 0x5f, 0x96, 0xf6, 0xa9, 0xe8, 0x0b, 0x60, 0x4d, 0x39, 0x3a, 0xab,
-  0x02, 0x33, 0x86, 0x3b, 0x2a, 0xdb, 0xe5, 0x7c, 0xfc, 0x23, 0xb4, 0x63,
-  0x73, 0x63, 0xa7, 0x01, 0xb4, 0x8c, 0x65, 0xee, 0xf7, 0xd8, 0x33, 0x67,
-  0x65, 0x5f, 0xa0, 0xe1, 0x4f, 0x87, 0xa5, 0x8d, 0xca, 0x80, 0xf8, 0x2d,
-  0xda, 0xc7, 0x65, 0x30, 0xf8, 0x10, 0x4b, 0x43, 0x5f, 0x10, 0x6b, 0x48,
-  0x62, 0xe9, 0xc0, 0x0c, 0x91, 0x4e, 0x76, 0xb2, 0x32, 0xf9, 0x03, 0x29,
-  0xff, 0xf8, 0xf8, 0xf1, 0x83, 0x17, 0xb0, 0x6c, 0x31, 0x7c, 0x0c, 0x51,
-  0xd2, 0xb5, 0x7d, 0x81, 0x86, 0x3f, 0x1d, 0x96, 0x32, 0x2a, 0xc3, 0xe2,
-  0x37, 0x6b, 0x5f, 0x3f, 0x84, 0xb5, 0x4f, 0x45, 0x5f, 0x18, 0x6b, 0x4a,
-  0x61, 0x29, 0x63, 0xc5, 0x8c, 0x3d, 0x1b, 0x4e, 0xf4, 0xe0, 0x1d, 0xcd,
-  0x30, 0xd5, 0xff, 0xf9, 0xeb, 0x2f, 0xa4, 0xfd, 0xc7, 0x0f, 0xb1, 0x41,
-  0xac, 0xa8, 0xa8, 0x6b, 0xfb, 0x02, 0x0d, 0x7f, 0x3a, 0xac, 0x53, 0xdd,
-  0xea, 0x5e, 0xfc, 0x16, 0xed, 0x43, 0xf1, 0xdb, 0x6b, 0x9f, 0x96, 0xbe,
-  0x5c, 0xac, 0x17, 0xc4, 0x8a, 0xe9, 0xc7, 0x91, 0x57, 0x21, 0xe9, 0xa9,
-  0x0c, 0x57, 0xc0, 0x61, 0xde, 0x2a, 0xbc, 0x3c, 0x9f, 0xca, 0x68, 0xdf,
-  0x4b, 0xfb, 0x02, 0x7d, 0x0f, 0x59, 0x8a, 0x75, 0xae, 0x5b, 0x0d, 0x89,
-  0x9f, 0xd5, 0x3e, 0x11, 0x3f, 0xd4, 0xbe, 0x1e, 0xce, 0xd3, 0x47, 0x46,
-  0x39, 0x58, 0xaf, 0x88, 0x15, 0x33, 0x7e, 0x61, 0xaa, 0x63, 0x2e, 0x77,
-  0xb4, 0x8b, 0xc4, 0xad, 0x51, 0x3f, 0xd8, 0x75, 0x79, 0x7c, 0x9f, 0xe9,
-  0x0b, 0x34, 0x3d, 0xa4, 0x0e, 0x4b, 0xdb, 0xad, 0x2e, 0xe2, 0xf7, 0x0c,
-  0x8a, 0x1f, 0x6b, 0xdf, 0x08, 0x2f, 0xa1, 0xcf, 0x4c, 0x26, 0x8d, 0x15,
-  0x90, 0xbc, 0x52, 0x30, 0x63, 0xc6, 0x71, 0xec, 0x4d, 0x87, 0xa4, 0x3f,
-  0x88, 0x74, 0x89, 0xfa, 0x39, 0xcd, 0x33, 0x37, 0x3e, 0x6b, 0xfb, 0x02,
-  0x0d, 0x7f, 0x3a, 0x2c, 0x75, 0xb7, 0x6a, 0x3a, 0x27, 0x7e, 0x7c, 0xf5,
-  0xbd, 0xf8, 0x05, 0xb5, 0x4f, 0x45, 0x9f, 0xdc, 0x98, 0x60, 0x3d, 0x0f,
-  0xb1, 0x42, 0xb5, 0xa8, 0x10, 0x0c, 0x03, 0x1d, 0x39, 0xe7, 0x54, 0x1f,
-  0x26, 0xd9, 0x64, 0x40, 0x9c, 0x0f, 0xf4, 0x07, 0x98, 0x5c, 0xd6, 0x95,
-  0x7d, 0x81, 0x8a, 0x3f, 0x15, 0x96, 0xba, 0x5b, 0xc5, 0x3a, 0x30, 0x8b,
-  0x9f, 0x94, 0x89, 0x1f, 0xee, 0xe8, 0x22, 0xda, 0xa7, 0xa1, 0x8f, 0xa0,
-  0x3a, 0xda, 0xd3, 0x46, 0x58, 0xcf, 0x7c, 0xac, 0x72, 0x30, 0xa9, 0xfb,
-  0xbd, 0x84, 0x4a, 0xc7, 0xc9, 0x80, 0x7f, 0x11, 0xeb, 0xc8, 0x79, 0xdf,
-  0x67, 0x16, 0x77, 0x65, 0x5f, 0x60, 0x46, 0xd3, 0x41, 0x21, 0x7f, 0x3a,
-  0x2c, 0x75, 0xb7, 0x4a, 0x70, 0xa3, 0x88, 0x5f, 0x81, 0xf6, 0x19, 0xc3,
-  0x43, 0x2c, 0xa3, 0x8f, 0x6b, 0x2e, 0x8d, 0x82, 0xb0, 0xf6, 0x50, 0x50,
-  0xbd, 0x0a, 0xcc, 0xb0, 0xa4, 0xf7, 0x86, 0x48, 0x07, 0xfb, 0x00, 0x04,
-  0xfd, 0x29, 0xa4, 0x53, 0x34, 0x40, 0x5e, 0xa2, 0xab, 0xfa, 0x02, 0x15,
-  0x7f, 0x2a, 0x2c, 0x7d, 0xb7, 0x8a, 0x96, 0x5f, 0xc8, 0x3a, 0x89, 0xdf,
-  0x56, 0xfb, 0xa2, 0x59, 0xd0, 0x9b, 0x52, 0xfa, 0x18, 0x09, 0xcd, 0x68,
-  0x5b, 0x17, 0xef, 0xef, 0x59, 0xe9, 0x2c, 0xbc, 0x10, 0x4c, 0x90, 0x30,
-  0xd1, 0xc1, 0x66, 0x39, 0x87, 0x0c, 0xb9, 0x14, 0xaf, 0x42, 0x41, 0x6e,
-  0x20, 0x47, 0xd1, 0x63, 0x7d, 0xc1, 0x66, 0x82, 0xa1, 0xe1, 0xcf, 0xfb,
-  0x32, 0x17, 0x4b, 0x89, 0x14, 0xce, 0xf4, 0x91, 0x9f, 0xcb, 0x5a, 0xed,
-  0x9b, 0xac, 0xf6, 0xc5, 0x39, 0x77, 0x49, 0x9b, 0x4f, 0x1f, 0x23, 0x09,
-  0xe9, 0x04, 0xb6, 0xd2, 0xd9, 0xea, 0xa5, 0x60, 0xe4, 0x0d, 0x4b, 0xba,
-  0x15, 0x74, 0x9c, 0xce, 0x4e, 0xb4, 0x8e, 0x81, 0xd5, 0x9d, 0xfc, 0x9b,
-  0xc3, 0x7a, 0xa2, 0x2f, 0xf0, 0x88, 0xe8, 0xff, 0xf6, 0x86, 0x91, 0xcf,
-  0x9f, 0x67, 0x96, 0x87, 0x55, 0x84, 0x94, 0xe1, 0x52, 0x9e, 0xe6, 0x4b,
-  0x56, 0x50, 0x21, 0x1c, 0xa6, 0x14, 0x0f, 0x5c, 0x1e, 0xba, 0x22, 0xfa,
-  0x04, 0x49, 0xd4, 0x79, 0xad, 0xb3, 0x26, 0x51, 0x55, 0x0a, 0xc1, 0x28,
-  0x99, 0x7b, 0xf2, 0xa2, 0x90, 0xde, 0xc9, 0xd6, 0x41, 0xae, 0x12, 0xe8,
-  0xb7, 0x02, 0xd2, 0x73, 0xfa, 0x02, 0x18, 0xb1, 0x53, 0x32, 0x7e, 0xd2,
-  0x66, 0xf5, 0x90, 0x6b, 0xb3, 0x2c, 0xac, 0x42, 0xa4, 0x70, 0x75, 0xf0,
-  0xb8, 0x20, 0xff, 0x70, 0xd9, 0xe5, 0xc9, 0x3e, 0x79, 0x17, 0x92, 0x3d,
-  0x0e, 0xea, 0xc9, 0x7e, 0x88, 0x26, 0xda, 0x0b, 0xb3, 0xcc, 0xf2, 0x4b,
-  0x96, 0x6b, 0x9d, 0xed, 0xed, 0x10, 0x8f, 0xa5, 0xab, 0x08, 0x0c, 0x28,
-  0x01, 0x08, 0xa8, 0x02, 0x9b, 0xeb, 0xb2, 0x61, 0x74, 0x42, 0xce, 0x91,
-  0xf4, 0x5e, 0x58, 0x37, 0x09, 0x4d, 0x31, 0xa3, 0x1d, 0x70, 0xb4, 0x2f,
-  0x80, 0xf1, 0xde, 0x1b, 0xfc, 0xd5, 0x43, 0x66, 0xac, 0x84, 0xcc, 0xb2,
-  0xb0, 0x0a, 0x91, 0x1c, 0xd0, 0xba, 0x3a, 0xf8, 0x79, 0x31, 0xd2, 0x68,
-  0x24, 0x58, 0x08, 0x25, 0x3d, 0x95, 0x35, 0xa2, 0x8c, 0xbb, 0x21, 0x46,
-  0xfb, 0xa2, 0xa5, 0xe4, 0xa2, 0xdd, 0xd0, 0x71, 0xea, 0xf2, 0x36, 0x5d,
-  0x21, 0x1d, 0xaf, 0x34, 0xc2, 0x0b, 0xc0, 0x80, 0x5d, 0x38, 0x02, 0xbf,
-  0xe0, 0xd1, 0xdf, 0x81, 0xd7, 0x2a, 0xa5, 0xf2, 0x61, 0x18, 0x18, 0x97,
-  0xea, 0x04, 0x37, 0x26, 0x64, 0x2f, 0xdd, 0x17, 0xc0, 0xd8, 0xdf, 0xcd,
-  0xdd, 0xfc, 0xdd, 0x43, 0x4e, 0xac, 0x1c, 0x98, 0x65, 0x61, 0x6d, 0x91,
-  0xaa, 0x44, 0xa4, 0x40, 0xa8, 0x3a, 0xac, 0x48, 0x1f, 0x89, 0x74, 0x7e,
-  0x11, 0x0e, 0x03, 0x0a, 0xd2, 0xfd, 0x2d, 0x50, 0x79, 0xe8, 0xb9, 0x56,
-  0xaf, 0xe8, 0x4b, 0x14, 0x69, 0xbe, 0x31, 0xe0, 0x57, 0xee, 0x1e, 0x92,
-  0x7c, 0x1d, 0xe5, 0x39, 0x1e, 0x3c, 0xbe, 0x3e, 0x5c, 0x76, 0x0b, 0xc1,
-  0xe4, 0x86, 0x46, 0x4e, 0x65, 0xbe, 0x19, 0x70, 0x9b, 0xc3, 0x39, 0xb4,
-  0xa8, 0x2a, 0xd2, 0xed, 0x8e, 0x44, 0x3e, 0x44, 0x7b, 0xf7, 0x51, 0xf2,
-  0x88, 0x02, 0x87, 0xa0, 0x43, 0x7d, 0x01, 0x79, 0xd5, 0x98, 0xfb, 0x3c,
-  0xf0, 0x28, 0x7f, 0x47, 0x66, 0x5e, 0x0f, 0x62, 0xc1, 0x02, 0x58, 0x5b,
-  0x24, 0x97, 0x45, 0x06, 0xfa, 0x60, 0xa4, 0x48, 0xa0, 0x6c, 0xaa, 0x83,
-  0x97, 0x18, 0xc8, 0x06, 0xb9, 0x81, 0x5e, 0x1c, 0xa2, 0x4c, 0x20, 0x1f,
-  0xa7, 0x48, 0xb7, 0x43, 0x59, 0xd3, 0x57, 0xc5, 0xaa, 0x7b, 0xff, 0x25,
-  0xa4, 0x57, 0x42, 0x3a, 0x2f, 0x20, 0x90, 0xd0, 0x22, 0x2b, 0x86, 0xee,
-  0x17, 0x19, 0x1f, 0xc3, 0xc1, 0x56, 0x08, 0x66, 0x49, 0x27, 0x7f, 0xf4,
-  0x7c, 0x33, 0x64, 0xc8, 0x55, 0x5e, 0xea, 0x09, 0xd5, 0xc4, 0x11, 0xb3,
-  0xfc, 0x08, 0xce, 0x62, 0x7e, 0xb1, 0x57, 0x8c, 0x0d, 0x9c, 0x11, 0x76,
-  0x7d, 0x81, 0x14, 0x5d, 0x1c, 0x36, 0xb9, 0xd5, 0x85, 0x0f, 0xf3, 0x67,
-  0xdb, 0x09, 0x8a, 0x6f, 0x9e, 0x2b, 0xaf, 0xf8, 0xeb, 0xa5, 0x02, 0x79,
-  0x66, 0x1e, 0xd6, 0x02, 0xb6, 0xc3, 0xda, 0x22, 0x55, 0xc6, 0x46, 0x0a,
-  0x99, 0xa0, 0x77, 0x86, 0x6d, 0x54, 0x72, 0xa0, 0x6c, 0xaa, 0x83, 0xe7,
-  0x24, 0xc6, 0x14, 0xb5, 0xe5, 0x66, 0x6b, 0xec, 0x93, 0x8d, 0x0e, 0x70,
-  0x70, 0x1a, 0x58, 0xd1, 0x97, 0x9c, 0xf5, 0xca, 0x1d, 0xcb, 0xdb, 0xb5,
-  0x93, 0x15, 0x5a, 0x47, 0xba, 0x61, 0x92, 0xe0, 0x3c, 0x18, 0x47, 0x31,
-  0xde, 0xd2, 0x28, 0x39, 0x4d, 0xbd, 0x63, 0xd7, 0xd1, 0xf3, 0x58, 0x11,
-  0x71, 0x4a, 0x75, 0x74, 0x6b, 0x04, 0xce, 0x3a, 0x85, 0x34, 0x82, 0x82,
-  0xd1, 0x66, 0x81, 0xdf, 0x17, 0x38, 0x26, 0x24, 0xa5, 0x8c, 0x59, 0x1e,
-  0x4e, 0x00, 0x23, 0xfb, 0x49, 0xeb, 0xf1, 0xd7, 0x4b, 0xc3, 0xbd, 0x35,
-  0x73, 0x58, 0x1e, 0x58, 0x08, 0x6b, 0x8b, 0x64, 0x6c, 0xae, 0x5a, 0x93,
-  0x61, 0x1b, 0x95, 0x7d, 0xa0, 0x3a, 0x6c, 0x53, 0x9d, 0x9b, 0x6b, 0x77,
-  0x40, 0x97, 0x26, 0xfd, 0x8b, 0x7b, 0x71, 0x9f, 0xbe, 0x04, 0xe9, 0xb3,
-  0xd0, 0x76, 0xf6, 0xa5, 0xea, 0x49, 0xc2, 0x92, 0x6b, 0x11, 0x0d, 0xb4,
-  0x3f, 0x26, 0xbd, 0x00, 0x0c, 0xf8, 0x76, 0xd8, 0xc4, 0xde, 0x8c, 0x31,
-  0xdd, 0x83, 0x3a, 0x89, 0xa6, 0x69, 0xa8, 0xbb, 0x43, 0xd7, 0xf7, 0xec,
-  0x97, 0x18, 0xe9, 0xa3, 0xc4, 0x0b, 0x18, 0x97, 0x05, 0x83, 0xdf, 0x17,
-  0xb0, 0xaf, 0x8c, 0xcc, 0x47, 0x7a, 0x66, 0x02, 0x7c, 0xf0, 0x75, 0xd2,
-  0x2e, 0xfc, 0xb1, 0x1d, 0x37, 0x60, 0xbe, 0x99, 0xc5, 0x32, 0x3e, 0x58,
-  0x00, 0x6b, 0x8b, 0xd4, 0x4b, 0x54, 0x2e, 0x26, 0xdb, 0x48, 0xe9, 0x25,
-  0xce, 0xfc, 0xea, 0xb0, 0x6b, 0xe5, 0xc8, 0x51, 0xd6, 0x4d, 0x7d, 0x9a,
-  0xf4, 0x5e, 0x22, 0x05, 0x7c, 0xfa, 0x20, 0xae, 0x07, 0x4e, 0xb2, 0xc5,
-  0xc6, 0x36, 0xd5, 0x60, 0x49, 0x37, 0x7c, 0x1c, 0x90, 0x5e, 0x06, 0x06,
-  0xa3, 0x4d, 0x29, 0xb9, 0x1d, 0x74, 0x82, 0x31, 0x2d, 0x1e, 0x57, 0x3a,
-  0xda, 0x86, 0xfe, 0xd7, 0xf4, 0x11, 0x38, 0x47, 0x3a, 0xfe, 0xf3, 0x9c,
-  0x09, 0xe0, 0xe6, 0x00, 0x52, 0x8f, 0x7b, 0x7b, 0xb8, 0x84, 0x87, 0x55,
-  0xb0, 0xf4, 0x1c, 0x2c, 0x2e, 0x03, 0x17, 0xfe, 0x66, 0xb3, 0x7e, 0x65,
-  0x26, 0x58, 0xc6, 0x07, 0x0b, 0x63, 0xad, 0x91, 0x7a, 0x8e, 0x4a, 0xd3,
-  0xcf, 0xe3, 0x5b, 0x45, 0x8a, 0x0d, 0xca, 0x7e, 0x55, 0x1d, 0x56, 0x84,
-  0x88, 0x21, 0x8b, 0xae, 0x9b, 0x56, 0x55, 0xc9, 0x54, 0xb7, 0xa5, 0x73,
-  0xa1, 0x2f, 0xa6, 0x09, 0x1c, 0x90, 0x6e, 0x66, 0xb6, 0x21, 0x9d, 0x82,
-  0x98, 0x83, 0xf3, 0x30, 0xf3, 0x4a, 0xc1, 0xdc, 0x21, 0xd3, 0x92, 0xb6,
-  0x63, 0xbe, 0xdb, 0xeb, 0x8d, 0x8e, 0x96, 0x67, 0x72, 0x23, 0x67, 0x7a,
-  0x2c, 0x70, 0x46, 0xae, 0xff, 0x2e, 0x0f, 0x1c, 0xe9, 0xd2, 0x3e, 0x4a,
-  0x5f, 0x20, 0x5e, 0x5b, 0x0f, 0x64, 0x09, 0x96, 0x75, 0x06, 0x4a, 0x3b,
-  0x61, 0xd3, 0x76, 0x1c, 0x57, 0x02, 0x0a, 0x7b, 0xb0, 0x20, 0x56, 0xbf,
-  0x52, 0x5d, 0x12, 0xf2, 0x99, 0xf3, 0x11, 0xba, 0x70, 0x54, 0xae, 0xab,
-  0xc3, 0x2e, 0xd5, 0xbf, 0x44, 0x8c, 0xa4, 0x05, 0x49, 0x3f, 0x89, 0xb2,
-  0xe5, 0xc1, 0xd0, 0x23, 0x14, 0xc7, 0x03, 0x06, 0x6b, 0xac, 0x05, 0x70,
-  0x77, 0x0a, 0x6c, 0xe3, 0xd6, 0x88, 0xed, 0x08, 0xa5, 0x7b, 0x7d, 0x09,
-  0xd8, 0x86, 0x7c, 0x24, 0x9b, 0x12, 0xbc, 0x69, 0x84, 0xf4, 0x1b, 0xf8,
-  0x1b, 0xc7, 0xe3, 0xd3, 0x3e, 0xa9, 0x7d, 0x76, 0x3e, 0xeb, 0xc6, 0xeb,
-  0xe7, 0xc9, 0x6e, 0x99, 0x27, 0xca, 0x5f, 0x65, 0x7b, 0xb9, 0x35, 0xe7,
-  0xc7, 0x60, 0x1b, 0xac, 0x75, 0xa7, 0xc5, 0x8d, 0xdd, 0x5c, 0x34, 0xe6,
-  0xe5, 0x88, 0x25, 0x52, 0x46, 0x37, 0x17, 0x3f, 0xd8, 0x35, 0x45, 0x82,
-  0x6b, 0x9b, 0x4e, 0xe9, 0x78, 0x4c, 0xba, 0x93, 0x93, 0xd9, 0x33, 0x5e,
-  0xd4, 0x11, 0xc8, 0xe5, 0xcb, 0x1c, 0xf7, 0x45, 0xae, 0xe1, 0x45, 0xd2,
-  0x6d, 0xdd, 0x61, 0x2c, 0xdb, 0x59, 0x8d, 0x11, 0xce, 0x0b, 0xc1, 0x3c,
-  0x3b, 0x2e, 0xea, 0xb7, 0x1b, 0x71, 0x8e, 0xec, 0xb7, 0xb7, 0xab, 0x23,
-  0x3d, 0x27, 0xa4, 0xdd, 0x1c, 0x00, 0xfc, 0xe1, 0x3a, 0x45, 0x15, 0xfd,
-  0xdd, 0xd6, 0x26, 0xbb, 0x18, 0xb8, 0x08, 0x25, 0xac, 0xf8, 0x9b, 0xcd,
-  0x00, 0x0e, 0xc1, 0x20, 0x0f, 0x0b, 0x8c, 0x05, 0x32, 0xc6, 0x0b, 0xc9,
-  0x25, 0x52, 0xe6, 0x29, 0x0c, 0x44, 0x56, 0xcb, 0x24, 0xf4, 0xcd, 0xc3,
-  0xae, 0xdc, 0xa6, 0xd7, 0x29, 0x59, 0x68, 0xa5, 0x38, 0xd8, 0x31, 0xc6,
-  0x44, 0x12, 0x6f, 0xe5, 0xcb, 0xad, 0x32, 0xb4, 0x2c, 0x78, 0xc6, 0x62,
-  0x49, 0x31, 0x4a, 0x4c, 0x18, 0xca, 0xc0, 0x7c, 0xd2, 0x2d, 0xe7, 0xd4,
-  0xc0, 0x51, 0xca, 0x23, 0xf1, 0x99, 0xa4, 0x7f, 0x71, 0xed, 0xa3, 0x50,
-  0x5c, 0x8f, 0x77, 0xa6, 0x82, 0xf5, 0x01, 0x0e, 0x83, 0xc5, 0x25, 0xed,
-  0x8a, 0x3f, 0x67, 0x76, 0x08, 0x96, 0x8d, 0x05, 0x56, 0x5e, 0x64, 0x7a,
-  0x1f, 0x88, 0xca, 0x60, 0x50, 0x6e, 0xeb, 0x60, 0x73, 0x6d, 0x97, 0xa3,
-  0xc9, 0x51, 0xf5, 0x2f, 0xa9, 0x62, 0x14, 0x2f, 0x86, 0x87, 0x98, 0x98,
-  0x03, 0x7d, 0xd9, 0x49, 0x2a, 0x29, 0xec, 0x82, 0x64, 0x15, 0x28, 0x11,
-  0x65, 0x65, 0x60, 0xce, 0xa8, 0x41, 0x8e, 0x6f, 0x44, 0x7a, 0x25, 0xb8,
-  0xc2, 0x7f, 0x0e, 0xe9, 0x32, 0x03, 0x90, 0x5c, 0x58, 0x8d, 0xf7, 0x7a,
-  0x6d, 0xe6, 0x15, 0xce, 0xe0, 0x4a, 0x97, 0xe3, 0x4f, 0x2a, 0xc4, 0x8e,
-  0xbf, 0x80, 0x99, 0x0f, 0x96, 0x8d, 0x05, 0xfd, 0x18, 0x8f, 0xca, 0x60,
-  0x50, 0xee, 0x1c, 0x44, 0x2e, 0x71, 0x47, 0xdb, 0x40, 0xce, 0xe7, 0x06,
-  0x1a, 0x1b, 0xd4, 0x77, 0x78, 0xe0, 0x10, 0x9b, 0x28, 0xe9, 0xc6, 0x4e,
-  0xb6, 0x09, 0xc9, 0xb6, 0x54, 0x72, 0x5b, 0x2c, 0x75, 0x69, 0x39, 0x29,
-  0x01, 0xf3, 0x48, 0x97, 0x4c, 0x97, 0x1b, 0xe4, 0xaf, 0x9b, 0x2a, 0x8b,
-  0x74, 0xa1, 0x8d, 0x67, 0x98, 0xd2, 0x01, 0x5e, 0x7d, 0xe7, 0xe4, 0x04,
-  0xcb, 0x01, 0x7f, 0x31, 0xb0, 0x02, 0x2c, 0xe9, 0x92, 0x62, 0x51, 0x99,
-  0xd1, 0x8e, 0x4b, 0x1e, 0x60, 0x01, 0x6c, 0xda, 0x6c, 0xd6, 0x2b, 0xb0,
-  0x6b, 0xb8, 0x38, 0x2d, 0x22, 0x23, 0x88, 0x55, 0x5c, 0x12, 0x21, 0xe9,
-  0x2b, 0x6a, 0xd7, 0x52, 0xb5, 0x2d, 0x16, 0x18, 0x38, 0x7a, 0x12, 0x74,
-  0x06, 0x6c, 0x26, 0x5d, 0x7c, 0x68, 0xeb, 0x4b, 0x73, 0x6b, 0xf3, 0x12,
-  0x7d, 0x9e, 0x00, 0xc8, 0x45, 0xb8, 0x15, 0xe0, 0x66, 0xb0, 0x4d, 0xb0,
-  0xae, 0xe2, 0x6f, 0x01, 0x2b, 0xc0, 0x92, 0xb5, 0x9a, 0xe2, 0xa8, 0xdc,
-  0x73, 0x2e, 0xd9, 0x27, 0x13, 0xda, 0x4c, 0xf7, 0x48, 0xfe, 0x61, 0xc0,
-  0x51, 0x52, 0xc5, 0xb9, 0x93, 0xd5, 0x3e, 0x33, 0x32, 0x69, 0x37, 0x81,
-  0xbb, 0xb6, 0x50, 0xf0, 0x19, 0xad, 0x05, 0x60, 0x1e, 0xe9, 0x57, 0x9a,
-  0xa5, 0xa1, 0x6b, 0x28, 0x9c, 0xb1, 0x12, 0x96, 0x7e, 0xd8, 0x3b, 0x70,
-  0xb1, 0xa0, 0x6e, 0xa0, 0x61, 0xdf, 0xb8, 0x79, 0x5f, 0x9c, 0x3f, 0x28,
-  0x8a, 0x15, 0x0d, 0x96, 0x2e, 0x2a, 0xb7, 0x2d, 0x8f, 0xe4, 0x84, 0x94,
-  0x0b, 0x2e, 0x18, 0x90, 0xdf, 0xe7, 0x4a, 0x39, 0x4b, 0x40, 0xb9, 0xa5,
-  0x3f, 0xb0, 0x37, 0x27, 0x23, 0x6d, 0x4a, 0x3e, 0x98, 0x37, 0x1f, 0x6c,
-  0x75, 0x53, 0x32, 0x5b, 0x02, 0x2a, 0x0f, 0xa5, 0xa4, 0x2f, 0x7d, 0x41,
-  0x63, 0xe7, 0x7f, 0x32, 0xef, 0x4b, 0x7e, 0x56, 0x72, 0x51, 0xac, 0x9c,
-  0xc1, 0xd2, 0x20, 0xf9, 0x70, 0xad, 0x2d, 0xb6, 0xb6, 0xc4, 0xe7, 0x7d,
-  0x68, 0x38, 0x2f, 0xa8, 0x11, 0x79, 0xc9, 0xe2, 0x20, 0xba, 0x4e, 0x65,
-  0x59, 0x72, 0x50, 0xee, 0xf0, 0x5a, 0xf2, 0xe9, 0xeb, 0xf9, 0x60, 0xe2,
-  0x0e, 0x4e, 0x75, 0x70, 0x9b, 0xae, 0xc0, 0x14, 0xff, 0x50, 0x87, 0xa5,
-  0x2f, 0x00, 0x17, 0x47, 0xd7, 0x0c, 0xfa, 0x6c, 0xbc, 0x95, 0xf1, 0xa7,
-  0xc2, 0x52, 0x46, 0x25, 0x59, 0x22, 0xc5, 0x7c, 0x79, 0x98, 0x83, 0x87,
-  0x64, 0x33, 0xf7, 0xa3, 0xe2, 0x81, 0xf3, 0x09, 0xd1, 0x53, 0xf1, 0x2f,
-  0xbd, 0x18, 0x57, 0x5b, 0x3c, 0x5d, 0x7a, 0xc7, 0xb6, 0x2d, 0x61, 0x3d,
-  0x1f, 0xcc, 0xf6, 0x6e, 0x57, 0x47, 0xba, 0x2c, 0x3d, 0x15, 0x17, 0x77,
-  0xaf, 0x2f, 0xb0, 0x32, 0x48, 0xf3, 0xbe, 0x8c, 0x9c, 0xb5, 0xf9, 0x97,
-  0xcf, 0x9f, 0x0e, 0x4b, 0x17, 0x95, 0xb6, 0x75, 0xe7, 0xce, 0x16, 0x7c,
-  0x77, 0xb5, 0xb9, 0xb9, 0x0e, 0x56, 0x3a, 0xd3, 0x3c, 0x80, 0x5b, 0x2f,
-  0x60, 0xf6, 0x50, 0x82, 0x38, 0x2a, 0x9b, 0xfc, 0x9a, 0x5b, 0x04, 0x66,
-  0xd7, 0x66, 0xd8, 0x87, 0x3c, 0x6d, 0x35, 0xa5, 0xd5, 0xdd, 0xd6, 0x8a,
-  0xc5, 0x89, 0x59, 0xf3, 0x3e, 0x98, 0xe9, 0xb3, 0xfc, 0x41, 0x0e, 0x7f,
-  0x4a, 0xac, 0x4d, 0xa4, 0xb8, 0x50, 0x49, 0x7b, 0xa7, 0x6d, 0x56, 0x76,
-  0x92, 0xfa, 0x48, 0xf9, 0x15, 0x20, 0xa3, 0xb3, 0x26, 0xf2, 0x38, 0xaa,
-  0xa1, 0xcd, 0x58, 0xbc, 0x35, 0x6e, 0x9b, 0x0c, 0x2d, 0x92, 0xb1, 0xe5,
-  0xf5, 0x56, 0xd0, 0x5e, 0xe5, 0x83, 0x71, 0x0a, 0x10, 0xe9, 0x7c, 0xa2,
-  0xb1, 0x0b, 0x99, 0x65, 0x3f, 0x7d, 0x45, 0x4a, 0xc5, 0xed, 0x3a, 0x27,
-  0x9f, 0x9b, 0xf7, 0x41, 0xc2, 0xca, 0xd1, 0x37, 0x47, 0x1f, 0x05, 0x5f,
-  0x94, 0x3f, 0x25, 0x16, 0x85, 0xca, 0x4a, 0xc5, 0xa5, 0xc0, 0x27, 0xfb,
-  0x2b, 0x5b, 0xdb, 0xaf, 0x37, 0xef, 0x44, 0x2a, 0xf0, 0xd2, 0x86, 0x9a,
-  0xd4, 0xee, 0x29, 0xdb, 0x01, 0x64, 0x91, 0xee, 0x26, 0x8f, 0x9c, 0x84,
-  0xcc, 0x3a, 0x57, 0xf8, 0xdc, 0x17, 0x0a, 0x8b, 0xc0, 0x58, 0xa3, 0xa8,
-  0x96, 0x78, 0x5b, 0x92, 0x4c, 0xc1, 0x5b, 0x4d, 0x5e, 0xd4, 0x34, 0xcd,
-  0xe2, 0xd1, 0xe4, 0xc4, 0x8f, 0x86, 0xd8, 0xb2, 0xac, 0x2c, 0x56, 0x68,
-  0x11, 0x9f, 0x0f, 0xe9, 0xb0, 0xa4, 0xb4, 0x4b, 0xa8, 0x40, 0xb5, 0x31,
-  0x4b, 0xce, 0x6b, 0x58, 0x05, 0xfc, 0x8e, 0x8a, 0x92, 0x9c, 0xb7, 0xe4,
-  0xd1, 0x6a, 0x67, 0x64, 0xfd, 0x16, 0xf3, 0xd6, 0x15, 0xe9, 0xdb, 0x35,
-  0xdb, 0xa1, 0x1c, 0x9f, 0xc2, 0x3a, 0x0d, 0xb7, 0x31, 0xbc, 0x45, 0x60,
-  0x4c, 0x58, 0x17, 0x82, 0xe1, 0x09, 0x58, 0xac, 0x5a, 0x27, 0xe9, 0xbc,
-  0x39, 0xc7, 0x6e, 0x98, 0xcc, 0x9f, 0xac, 0x71, 0xd4, 0x2c, 0x7e, 0xcf,
-  0x99, 0xf8, 0xb1, 0xd7, 0x5b, 0x7f, 0xde, 0x24, 0xe5, 0x3e, 0x6a, 0xa5,
-  0xc3, 0x0a, 0x58, 0x2d, 0x66, 0x31, 0x4f, 0x02, 0xcd, 0xee, 0x88, 0xf5,
-  0x76, 0xf3, 0xca, 0xad, 0x2c, 0x1f, 0x33, 0xef, 0x87, 0x5b, 0xd9, 0xb9,
-  0x97, 0x96, 0xea, 0x72, 0xbb, 0x66, 0x4b, 0xb3, 0x74, 0x0c, 0x2d, 0xef,
-  0x69, 0xb8, 0xd1, 0x22, 0x22, 0xef, 0x71, 0x49, 0x2d, 0xb6, 0x94, 0x82,
-  0x91, 0xfc, 0x53, 0xdb, 0xe7, 0x2d, 0x80, 0xca, 0xee, 0x51, 0x93, 0x1d,
-  0x9a, 0x2e, 0x6a, 0xbc, 0x95, 0xf3, 0xf4, 0xc4, 0x8f, 0x71, 0xa5, 0x50,
-  0xe6, 0x5b, 0xe9, 0xb0, 0x02, 0x56, 0x8b, 0x59, 0xc4, 0x93, 0xf4, 0xbc,
-  0xbf, 0x41, 0xab, 0xeb, 0xf6, 0x41, 0x04, 0xb8, 0x8d, 0x77, 0x91, 0xee,
-  0x87, 0x78, 0x68, 0x69, 0xa9, 0xe5, 0x96, 0xb9, 0x5e, 0xef, 0xe2, 0x5e,
-  0x96, 0x0d, 0x1b, 0xee, 0x18, 0x5a, 0xc3, 0x5b, 0x48, 0x4d, 0x6a, 0xf9,
-  0xbd, 0x14, 0x8c, 0xdc, 0xb5, 0x19, 0x3c, 0xed, 0x8e, 0xed, 0xa1, 0xcf,
-  0x27, 0x7d, 0x1d, 0x35, 0x59, 0x13, 0x3f, 0x6b, 0xb5, 0xaa, 0x44, 0x46,
-  0xf6, 0x5c, 0xff, 0x2c, 0xac, 0x90, 0x15, 0xc4, 0x3d, 0xc9, 0xfb, 0x74,
-  0xa0, 0xd9, 0x93, 0xde, 0x3b, 0xca, 0x8f, 0xab, 0x3b, 0x3f, 0x1d, 0x23,
-  0x79, 0x60, 0x7d, 0xce, 0xfd, 0x89, 0x88, 0xe0, 0x2f, 0x1b, 0x81, 0x71,
-  0x3b, 0x3c, 0x20, 0xb9, 0xd9, 0xbe, 0x04, 0x8c, 0x77, 0xc6, 0xf4, 0x66,
-  0xff, 0x0a, 0x52, 0x7e, 0x79, 0xdf, 0x47, 0x4d, 0x7a, 0xe2, 0xc7, 0x06,
-  0x5b, 0xaf, 0xa5, 0xa7, 0x8b, 0x2a, 0x2c, 0xa5, 0x95, 0x6c, 0x9e, 0x0e,
-  0x32, 0x0b, 0x96, 0xf0, 0xf8, 0x5b, 0x66, 0x64, 0xdd, 0x52, 0xa8, 0x51,
-  0xfe, 0x66, 0x2e, 0xe6, 0xf4, 0xa2, 0x7a, 0xcb, 0xe3, 0xe2, 0x83, 0x11,
-  0x9c, 0x03, 0x73, 0xb1, 0xa4, 0xfe, 0xd1, 0xd9, 0xc6, 0xec, 0xc7, 0x25,
-  0xcf, 0x2b, 0x4d, 0xec, 0x65, 0xcb, 0x5e, 0x61, 0xa5, 0xc3, 0x8a, 0x5b,
-  0x45, 0x5f, 0x65, 0xeb, 0x2d, 0xeb, 0xc7, 0x8b, 0xbb, 0xf1, 0x29, 0x18,
-  0xf9, 0xb5, 0x35, 0x26, 0xb7, 0x2f, 0x96, 0xd7, 0x3c, 0x1a, 0x3f, 0x53,
-  0x73, 0x5b, 0xf7, 0x32, 0x30, 0xb7, 0x6b, 0x11, 0xf4, 0x9c, 0xdb, 0xb7,
-  0x09, 0x8c, 0xf1, 0x73, 0xc4, 0x3d, 0x52, 0x39, 0x78, 0x1d, 0x47, 0x44,
-  0xb1, 0xd8, 0xaa, 0x3f, 0x67, 0x05, 0xf9, 0x56, 0xbe, 0x65, 0x0f, 0x1a,
-  0xef, 0x80, 0xdd, 0x2b, 0x30, 0xc7, 0x5c, 0x16, 0xe9, 0x26, 0xe7, 0x59,
-  0xea, 0x59, 0x30, 0xd9, 0x1c, 0x78, 0x86, 0x74, 0xb7, 0x49, 0xd5, 0x7b,
-  0x86, 0x6b, 0xec, 0xc6, 0x05, 0xbe, 0x85, 0xf0, 0xa7, 0x5a, 0xdd, 0x43,
-  0x56, 0x76, 0xb7, 0xda, 0xb1, 0x95, 0x0e, 0x6b, 0xb6, 0x32, 0xf9, 0x56,
-  0x4b, 0x97, 0xd1, 0x8f, 0x46, 0xe5, 0x1e, 0x80, 0xfb, 0x48, 0x1f, 0x4e,
-  0x62, 0x8c, 0x80, 0x64, 0x6c, 0xb8, 0xa1, 0x53, 0x79, 0x46, 0x00, 0x3f,
-  0x17, 0x8c, 0x9e, 0xe4, 0x9a, 0x13, 0xa9, 0x8e, 0xf4, 0xdd, 0xef, 0xbc,
-  0x59, 0xd3, 0xdb, 0x4c, 0x2a, 0xdb, 0x99, 0x7a, 0x6a, 0x07, 0xef, 0x07,
-  0xfd, 0xa0, 0xd9, 0x5b, 0x55, 0x46, 0x36, 0x40, 0x1f, 0x5a, 0xe9, 0xb0,
-  0x0e, 0xac, 0x24, 0xc2, 0x22, 0x23, 0x14, 0xef, 0xdc, 0xef, 0x70, 0xbf,
-  0x2b, 0xbd, 0x63, 0xb7, 0x59, 0x51, 0xa9, 0xe8, 0xb3, 0x1a, 0x63, 0x4e,
-  0x54, 0xd0, 0x55, 0x96, 0x12, 0x30, 0x7e, 0xc9, 0x63, 0xec, 0x8d, 0x39,
-  0x91, 0xeb, 0xe4, 0xd6, 0x3e, 0xd4, 0x0a, 0xc6, 0x3f, 0xb0, 0x21, 0x60,
-  0xb5, 0xd8, 0xbd, 0x12, 0x2b, 0x60, 0x65, 0xfb, 0xb0, 0xa4, 0x64, 0x42,
-  0xfe, 0x82, 0x58, 0xe2, 0x0a, 0x99, 0x9b, 0x21, 0xce, 0xe1, 0x65, 0x82,
-  0xcd, 0xb5, 0x6f, 0x3c, 0x71, 0x63, 0x95, 0x6e, 0x98, 0xff, 0x7e, 0xab,
-  0xef, 0x7a, 0x60, 0xed, 0xe3, 0xad, 0x3a, 0xf7, 0xb7, 0x53, 0xfe, 0x9c,
-  0x63, 0xae, 0x7d, 0x6f, 0x57, 0xfc, 0x59, 0x87, 0xb2, 0xf6, 0xd5, 0x8a,
-  0xe3, 0x6d, 0xf5, 0xbb, 0x59, 0xbd, 0x8f, 0xf7, 0xf1, 0x3e, 0xbe, 0xd5,
-  0xf1, 0xce, 0xea, 0xef, 0x4c, 0xee, 0x41, 0xd1, 0xae, 0x7f, 0x6a, 0x80,
-  0xd4, 0x49, 0xbb, 0x3a, 0x34, 0xd4, 0xcd, 0xbf, 0xc5, 0xce, 0x39, 0xba,
-  0x56, 0x1d, 0xef, 0x4f, 0x56, 0xa7, 0xc8, 0x77, 0xd6, 0xc2, 0xe6, 0x8d,
-  0xfc, 0x77, 0x96, 0xbb, 0xfa, 0x5c, 0xc8, 0x90, 0x5b, 0x7e, 0x0d, 0xe9,
-  0x55, 0x06, 0xe9, 0xd5, 0x09, 0xd2, 0x77, 0x71, 0x53, 0xf3, 0xef, 0xfa,
-  0x70, 0xe4, 0xbf, 0x35, 0xe9, 0xf6, 0xe6, 0xf8, 0x0b, 0x1b, 0xd6, 0xf5,
-  0xfc, 0xbd, 0xf9, 0x5b, 0xc7, 0xae, 0xaa, 0x7f, 0x42, 0xb8, 0xfd, 0x1b,
-  0x48, 0xaf, 0x0e, 0x49, 0xaf, 0xbe, 0x0d, 0xe9, 0xf6, 0xbf, 0x85, 0x48,
-  0x6e, 0xf2, 0x13, 0xb4, 0x7a, 0x51, 0x51, 0x7b, 0x21, 0xb2, 0xaa, 0x88,
-  0xae, 0x48, 0xce, 0x71, 0x64, 0xcb, 0xe8, 0xce, 0x2a, 0x70, 0xbe, 0x8c,
-  0xc1, 0x0b, 0x2e, 0xef, 0xcc, 0x15, 0xae, 0x4f, 0xc4, 0x66, 0x24, 0xf5,
-  0x21, 0x4a, 0xe8, 0x6a, 0x55, 0xed, 0x87, 0x72, 0xbd, 0x8e, 0x79, 0x2f,
-  0x25, 0x02, 0x58, 0xbf, 0x4f, 0x69, 0x8f, 0x90, 0x5e, 0x65, 0x92, 0xbe,
-  0xba, 0xca, 0x36, 0xff, 0x57, 0xdf, 0xa9, 0xeb, 0xfd, 0xf7, 0x36, 0xd9,
-  0x54, 0x07, 0x46, 0x56, 0xed, 0x7e, 0x57, 0x07, 0xe3, 0xab, 0x83, 0xb6,
-  0xfb, 0x33, 0x43, 0xa5, 0x5b, 0x46, 0xb8, 0xbb, 0x91, 0xdd, 0xf5, 0xe3,
-  0xe3, 0xff, 0x7d, 0x48, 0xaf, 0x5f, 0x40, 0xba, 0x97, 0x53, 0xf5, 0x26,
-  0xa7, 0x16, 0xd2, 0x77, 0xc4, 0x06, 0x2b, 0x43, 0x11, 0xe9, 0xbb, 0x46,
-  0x2b, 0x40, 0xf7, 0xdc, 0x7b, 0xac, 0x6d, 0xb7, 0x7d, 0xec, 0x72, 0xb5,
-  0x35, 0xdb, 0x11, 0xd2, 0xf7, 0xe3, 0xff, 0x4d, 0x9a, 0xf7, 0xba, 0x5e,
-  0xb9, 0x67, 0x4b, 0x54, 0x8e, 0xa6, 0xd7, 0x2b, 0xc7, 0xd4, 0x07, 0x12,
-  0x12, 0x20, 0xfd, 0x40, 0x2d, 0x37, 0xc4, 0xd5, 0xf1, 0x4c, 0x3f, 0x18,
-  0x4f, 0x1d, 0xad, 0x3f, 0x75, 0xbd, 0xeb, 0x10, 0xea, 0xcd, 0x65, 0xeb,
-  0x83, 0x51, 0xa6, 0xc6, 0xff, 0x2d, 0x7a, 0xf9, 0x1c, 0xd2, 0x2b, 0x5f,
-  0x24, 0x8f, 0xc4, 0xb3, 0x5e, 0xcd, 0x13, 0xeb, 0x8d, 0x95, 0x7f, 0xbe,
-  0x9f, 0x89, 0x73, 0x8f, 0x99, 0xd4, 0xf4, 0x75, 0x9f, 0x50, 0x45, 0x35,
-  0x3d, 0xac, 0xd7, 0x95, 0x5f, 0x13, 0xea, 0xfd, 0xac, 0x76, 0x75, 0xb5,
-  0x2a, 0x30, 0xfe, 0x3f, 0x80, 0xf4, 0xf7, 0x62, 0xcf, 0xf7, 0x5c, 0x89,
-  0x7b, 0x49, 0x14, 0xbf, 0x49, 0x7f, 0x07, 0xd3, 0xfb, 0xf8, 0x5d, 0x8f,
-  0xff, 0x01, 0xe3, 0xb0, 0x02, 0x98, 0x0d, 0x72, 0x06, 0x0b, 0x00, 0x00,
-  0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int possum_right_png_len = 4702;
-unsigned char tiles_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0xbf, 0x5a, 0xfd, 0x39, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
-  0x00, 0x54, 0x50, 0x4c, 0x54, 0x45, 0xd1, 0x11, 0xe1, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x4a, 0x0a, 0x00, 0x57, 0x14, 0x00,
-  0x64, 0x1e, 0x00, 0x04, 0x40, 0x00, 0x71, 0x29, 0x00, 0x03, 0x4d, 0x00,
-  0x87, 0x34, 0x00, 0xff, 0x00, 0xff, 0x03, 0x67, 0x00, 0x93, 0x46, 0x00,
-  0x02, 0x73, 0x00, 0x02, 0x80, 0x00, 0x02, 0x8d, 0x00, 0xa8, 0x65, 0x0e,
-  0x50, 0x79, 0xe1, 0x80, 0x80, 0x80, 0x01, 0xb3, 0x00, 0x5d, 0x82, 0xe1,
-  0xbe, 0x85, 0x1c, 0xd5, 0xa6, 0x2b, 0x00, 0xf3, 0x00, 0x3e, 0xfc, 0x3e,
-  0xff, 0xd5, 0x2b, 0xff, 0xff, 0xff, 0x0d, 0xc2, 0x50, 0x14, 0x00, 0x00,
-  0x00, 0x01, 0x74, 0x52, 0x4e, 0x53, 0x00, 0x40, 0xe6, 0xd8, 0x66, 0x00,
-  0x00, 0x00, 0x01, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x88, 0x05, 0x1d, 0x48,
-  0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
-  0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00,
-  0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xdd, 0x05, 0x1f, 0x0c, 0x06, 0x31,
-  0xac, 0x70, 0x33, 0x30, 0x00, 0x00, 0x08, 0x6c, 0x49, 0x44, 0x41, 0x54,
-  0x78, 0xda, 0xed, 0x9b, 0x8d, 0x62, 0xa3, 0x28, 0x10, 0x80, 0x25, 0x08,
-  0xb8, 0x54, 0x8d, 0xf4, 0x3c, 0x4d, 0xeb, 0xfb, 0xbf, 0xe7, 0xcd, 0x0c,
-  0xa0, 0x88, 0x10, 0x35, 0x4d, 0x7b, 0xb7, 0xb7, 0x21, 0xbb, 0x25, 0x18,
-  0x18, 0xc8, 0xc0, 0x7c, 0x0c, 0x3f, 0x29, 0x58, 0x14, 0x0a, 0x0a, 0x14,
-  0x53, 0x52, 0xba, 0xd0, 0xb8, 0x80, 0xcf, 0x4b, 0x21, 0x8c, 0x10, 0xd3,
-  0x28, 0x8c, 0x16, 0xc5, 0x4e, 0x10, 0xcd, 0x34, 0x35, 0x42, 0xe8, 0x71,
-  0x9a, 0xb4, 0x31, 0x9a, 0xe4, 0x56, 0x8d, 0x19, 0x4c, 0x53, 0xe5, 0xe4,
-  0x1f, 0x08, 0x4b, 0xfb, 0x6c, 0xb4, 0xc4, 0x81, 0x3c, 0x5d, 0x49, 0xc1,
-  0x18, 0x55, 0xb5, 0xc8, 0x8f, 0xd3, 0x71, 0xfe, 0xe2, 0x6d, 0x15, 0x8a,
-  0x3d, 0x7d, 0x04, 0xe9, 0x4a, 0x56, 0xae, 0xfd, 0x6c, 0xd5, 0xd6, 0x01,
-  0x3e, 0xe1, 0x8c, 0x05, 0x69, 0x8d, 0xe9, 0x40, 0xdd, 0x67, 0x82, 0x2b,
-  0x68, 0x85, 0x9c, 0x2a, 0xb8, 0x96, 0x02, 0xfa, 0x37, 0xa3, 0x61, 0x99,
-  0x0a, 0xe6, 0xf8, 0xfd, 0xef, 0xf5, 0x2b, 0x21, 0x58, 0xdd, 0xba, 0xba,
-  0xab, 0x55, 0x36, 0x9d, 0xcb, 0x5f, 0xdf, 0xba, 0x6b, 0x1b, 0xa7, 0xef,
-  0xe8, 0x37, 0x4a, 0xeb, 0x4a, 0x38, 0x5d, 0xf0, 0x43, 0xe3, 0x27, 0xad,
-  0x70, 0x76, 0x48, 0xdb, 0xc5, 0xff, 0x37, 0xb0, 0x0d, 0x01, 0xf0, 0x4f,
-  0x5d, 0xe3, 0x9f, 0xb6, 0xad, 0x59, 0x0a, 0x00, 0x1c, 0x0c, 0x5a, 0x80,
-  0x45, 0x63, 0xd8, 0x93, 0x0f, 0x98, 0x00, 0x56, 0x40, 0x68, 0xc6, 0x06,
-  0x80, 0x61, 0xe5, 0x57, 0xc6, 0x34, 0x19, 0xf9, 0x6c, 0xaf, 0xb5, 0x51,
-  0xfb, 0x28, 0xba, 0xb6, 0x36, 0xee, 0x5a, 0xf6, 0x55, 0x00, 0x80, 0xc9,
-  0x87, 0xe6, 0xff, 0xb6, 0xa7, 0x8f, 0x25, 0x5d, 0x49, 0xf8, 0x62, 0x34,
-  0x00, 0xd9, 0xea, 0x5b, 0xc0, 0x53, 0x09, 0xb6, 0x3a, 0xdb, 0x9a, 0x03,
-  0x42, 0x33, 0x8e, 0xd0, 0x12, 0x56, 0x1c, 0x1d, 0x61, 0xbe, 0x77, 0x5c,
-  0x39, 0x2b, 0xe4, 0x4c, 0x47, 0xc7, 0x8d, 0x4a, 0xdb, 0x7f, 0xac, 0xcf,
-  0x77, 0xb0, 0xfa, 0xf0, 0xff, 0x77, 0x02, 0xe0, 0xe3, 0x0c, 0x00, 0x34,
-  0x53, 0x1d, 0x94, 0x52, 0x75, 0xd7, 0x29, 0xf6, 0x05, 0x00, 0xe4, 0xb5,
-  0xbf, 0x99, 0x16, 0xff, 0x08, 0x00, 0xb4, 0xac, 0x6d, 0xfb, 0x0e, 0x42,
-  0xdd, 0x77, 0x7d, 0xd7, 0x76, 0xa9, 0x19, 0xda, 0xba, 0x00, 0x5a, 0xeb,
-  0xaa, 0xd2, 0x7b, 0xf2, 0x0d, 0x0c, 0x58, 0x21, 0xab, 0x0a, 0x30, 0x80,
-  0xf6, 0x5f, 0x90, 0x7c, 0xb2, 0xa9, 0xb4, 0x7c, 0x75, 0x4f, 0xd9, 0xd0,
-  0xe7, 0x71, 0xfb, 0xda, 0xbe, 0xed, 0xe0, 0x0f, 0xbc, 0xeb, 0x6b, 0x55,
-  0xf7, 0xed, 0x13, 0x00, 0x10, 0x86, 0xb7, 0x3d, 0x7d, 0x2c, 0x69, 0x89,
-  0x73, 0x91, 0x21, 0x53, 0x1b, 0x65, 0xf0, 0x2d, 0x18, 0x54, 0x08, 0xb6,
-  0x3a, 0x06, 0x00, 0xc0, 0xc9, 0x7b, 0x30, 0xa0, 0x40, 0x00, 0x62, 0x0c,
-  0x82, 0x4c, 0xec, 0xf3, 0xf9, 0x72, 0x67, 0x3d, 0x80, 0xb8, 0x51, 0xba,
-  0x62, 0xc9, 0xf9, 0x3f, 0xd6, 0xe7, 0xbb, 0x33, 0x7d, 0x1f, 0x63, 0x96,
-  0xa2, 0xa3, 0xd7, 0x51, 0x00, 0xf8, 0xfc, 0xbe, 0x54, 0x1e, 0x00, 0xfd,
-  0x71, 0x00, 0x54, 0x4c, 0xf5, 0x75, 0x0f, 0x3d, 0xd3, 0x43, 0x04, 0x04,
-  0x38, 0x08, 0x80, 0x3d, 0x03, 0xc8, 0xa4, 0xff, 0x20, 0x00, 0x40, 0xff,
-  0x63, 0xc7, 0xf4, 0x9d, 0xea, 0x69, 0xe0, 0x27, 0x01, 0x80, 0x2e, 0x80,
-  0xb1, 0x21, 0x2b, 0xd6, 0xbd, 0xa1, 0x95, 0xc2, 0x00, 0x43, 0x97, 0x66,
-  0xc8, 0xa2, 0xd8, 0x93, 0x5f, 0xdf, 0x21, 0x00, 0x41, 0x23, 0x2a, 0x4f,
-  0x76, 0x09, 0x4f, 0x60, 0x18, 0xc0, 0x80, 0xed, 0xfa, 0x2f, 0x03, 0x60,
-  0x45, 0x80, 0xb7, 0x37, 0x5f, 0xdf, 0x4a, 0x7e, 0xc9, 0x79, 0x29, 0xf5,
-  0x52, 0x9e, 0xd2, 0xe8, 0xd6, 0x8b, 0x01, 0x4d, 0x6d, 0xfa, 0x0c, 0x6d,
-  0x93, 0x6c, 0x15, 0xa6, 0xdb, 0xc8, 0x03, 0x30, 0xe2, 0x52, 0xe2, 0x32,
-  0x28, 0x02, 0x41, 0x36, 0xf6, 0xf9, 0x5c, 0x39, 0x73, 0xce, 0x03, 0xd8,
-  0x34, 0xaa, 0xc1, 0x16, 0x25, 0xca, 0xc7, 0xfa, 0x4c, 0x79, 0x00, 0x5d,
-  0xd1, 0xc3, 0xeb, 0xb8, 0x07, 0x60, 0xf3, 0xcf, 0xd4, 0xc8, 0x2f, 0x01,
-  0x3e, 0xae, 0xf5, 0x51, 0x00, 0x08, 0x85, 0x43, 0x00, 0xc9, 0xdc, 0x2b,
-  0xf8, 0xc7, 0xe7, 0xfe, 0x4d, 0x2e, 0x69, 0x8f, 0xcf, 0xf5, 0x89, 0xd5,
-  0xf0, 0x9f, 0x05, 0x80, 0x1b, 0xea, 0xf5, 0xe3, 0x8a, 0xbd, 0x0f, 0x1d,
-  0xd4, 0xb5, 0xc9, 0x35, 0x3a, 0xb9, 0x00, 0x06, 0x4c, 0x7b, 0x14, 0x19,
-  0xa1, 0x5a, 0x3b, 0xa5, 0x41, 0x26, 0x32, 0x7f, 0x2d, 0xad, 0x1a, 0xf7,
-  0xe4, 0x5f, 0xf3, 0x04, 0x00, 0xe6, 0xc3, 0xd0, 0x8c, 0xca, 0xd7, 0x37,
-  0x78, 0x52, 0xe3, 0x2c, 0x40, 0xfe, 0xe0, 0xd3, 0x01, 0xe0, 0xeb, 0x0b,
-  0xe5, 0xdb, 0x05, 0x7c, 0xa9, 0x7d, 0x79, 0x97, 0x16, 0x5c, 0x8c, 0x00,
-  0x44, 0xf6, 0xf9, 0xf9, 0x09, 0xb8, 0x0b, 0x01, 0x50, 0x05, 0xf6, 0xef,
-  0x55, 0xae, 0x65, 0x33, 0x18, 0xc9, 0x36, 0x20, 0xc8, 0xc5, 0x3e, 0x9f,
-  0x2f, 0x77, 0x6e, 0x5c, 0x6e, 0x1a, 0x65, 0xd0, 0x01, 0x48, 0x01, 0x20,
-  0xd2, 0x67, 0x62, 0x0f, 0x00, 0xec, 0x18, 0xe6, 0xdd, 0xe3, 0x1e, 0x80,
-  0xcb, 0x0f, 0x60, 0xe9, 0x8a, 0xf6, 0x0e, 0x00, 0x54, 0x7f, 0xbb, 0xaa,
-  0xa3, 0x00, 0x80, 0xc1, 0xa0, 0x68, 0x10, 0x40, 0x1b, 0xe1, 0x2d, 0xfb,
-  0x12, 0x00, 0x12, 0x13, 0xd7, 0xb9, 0x62, 0xff, 0x23, 0x00, 0x60, 0x57,
-  0x58, 0xfc, 0x2b, 0x70, 0xc9, 0x72, 0x00, 0xa0, 0x5d, 0x00, 0x58, 0xd8,
-  0x8b, 0x29, 0x6d, 0xfe, 0xcb, 0xf2, 0x12, 0xec, 0x3f, 0x30, 0x7f, 0x18,
-  0x60, 0x3b, 0xf2, 0x55, 0x97, 0x07, 0x40, 0x77, 0xfd, 0x55, 0xc7, 0xe5,
-  0xd5, 0x8d, 0x9e, 0xd4, 0x9d, 0xaa, 0x15, 0xe7, 0xaa, 0x7b, 0x36, 0x00,
-  0x7c, 0x7d, 0x81, 0x7c, 0xbf, 0x81, 0x47, 0x04, 0x58, 0xa5, 0x41, 0x34,
-  0x1a, 0xfc, 0x30, 0x44, 0x1e, 0xc0, 0xca, 0xfe, 0x8b, 0x59, 0x85, 0x42,
-  0xf0, 0x2d, 0x08, 0x72, 0xb1, 0xcf, 0xe7, 0xca, 0x9d, 0xed, 0xe6, 0xb8,
-  0x51, 0x39, 0x00, 0xc4, 0xfa, 0x4c, 0x79, 0x00, 0x40, 0x08, 0x98, 0x79,
-  0x8f, 0x7b, 0x00, 0x36, 0x3f, 0xa8, 0xb1, 0xbb, 0xde, 0xf3, 0x00, 0x14,
-  0x62, 0xfd, 0x38, 0x00, 0x6a, 0xb0, 0x7b, 0x5e, 0xd7, 0x1c, 0xa2, 0x7a,
-  0x01, 0xc0, 0xce, 0x48, 0x5f, 0x3f, 0x39, 0x6c, 0x20, 0xe7, 0x8b, 0xfd,
-  0xb6, 0x00, 0x50, 0xb4, 0xaf, 0x82, 0x1d, 0x22, 0xc0, 0x25, 0xeb, 0xea,
-  0xf4, 0x2e, 0xbd, 0x3b, 0x08, 0x18, 0xa7, 0x31, 0x6d, 0xfe, 0xe0, 0xb5,
-  0x3a, 0x17, 0x40, 0x90, 0xf9, 0x5f, 0x2e, 0x5e, 0x6b, 0x7b, 0xf2, 0xd5,
-  0x35, 0x0f, 0x00, 0xf0, 0x0e, 0x54, 0x5c, 0x5e, 0x75, 0xf4, 0x04, 0xff,
-  0xe0, 0x80, 0x6d, 0x9f, 0x0d, 0x80, 0xa5, 0x3e, 0x2f, 0xbf, 0x9c, 0x75,
-  0x25, 0xa9, 0xfc, 0x3a, 0x5d, 0xe0, 0x9c, 0x6d, 0x62, 0x00, 0x8c, 0x99,
-  0x99, 0x85, 0x6d, 0x41, 0x90, 0x8b, 0xbd, 0xe1, 0x3f, 0xb6, 0x2b, 0xe5,
-  0x1a, 0xc5, 0xf6, 0x01, 0x10, 0xe9, 0x33, 0x5c, 0xff, 0xbf, 0xdb, 0x3d,
-  0x00, 0x74, 0xc4, 0xee, 0x19, 0xfc, 0x26, 0xed, 0xf2, 0x03, 0x45, 0xaf,
-  0xf7, 0x3c, 0x80, 0x02, 0xa6, 0xf3, 0xe2, 0x28, 0x00, 0x38, 0x03, 0xeb,
-  0x87, 0x16, 0x42, 0x1b, 0x81, 0x01, 0x8c, 0x3f, 0x00, 0x80, 0x63, 0x6a,
-  0x7c, 0xb0, 0xd8, 0x6f, 0x0b, 0x80, 0x52, 0xa9, 0x52, 0x39, 0xfc, 0xa7,
-  0x5c, 0xb2, 0x65, 0xfe, 0xd2, 0x06, 0xd6, 0xf7, 0x3a, 0x6d, 0xfe, 0x30,
-  0xdc, 0x9c, 0x0b, 0x60, 0xcd, 0x7f, 0x01, 0xc0, 0x9e, 0x7c, 0x75, 0x67,
-  0x09, 0x50, 0xff, 0x52, 0x9b, 0xf6, 0x09, 0x48, 0xf2, 0x12, 0x87, 0x2c,
-  0x07, 0x1f, 0x5c, 0xd5, 0xcf, 0x06, 0x80, 0xaf, 0x0f, 0x0c, 0x82, 0x95,
-  0x24, 0x1f, 0xcc, 0xe8, 0xaf, 0x09, 0x5e, 0xa0, 0x2b, 0x83, 0xe5, 0xf9,
-  0xa2, 0x3b, 0x83, 0xf2, 0x61, 0xd9, 0xde, 0x44, 0xc7, 0x7e, 0x6c, 0xcc,
-  0x0f, 0x9a, 0x18, 0x04, 0x99, 0xf8, 0x41, 0xc3, 0x9f, 0x2b, 0x19, 0x68,
-  0x0f, 0x66, 0x39, 0x8a, 0xc8, 0x01, 0x20, 0xd6, 0x67, 0xc2, 0x03, 0xd8,
-  0x35, 0xf8, 0x4c, 0x7a, 0x17, 0x00, 0x18, 0x8e, 0x02, 0xa0, 0x2c, 0x39,
-  0x36, 0x14, 0x02, 0x57, 0xf0, 0xb6, 0x3c, 0x0f, 0x80, 0x33, 0xa7, 0x2f,
-  0xe7, 0x8b, 0xfd, 0xbe, 0x00, 0x28, 0x45, 0x89, 0xf8, 0x47, 0xb4, 0xa2,
-  0x4b, 0x16, 0x2b, 0xbe, 0x08, 0x5c, 0x00, 0xf0, 0x01, 0x9a, 0xa4, 0xf9,
-  0xe3, 0xba, 0xd5, 0xb9, 0x00, 0x68, 0xfe, 0xd8, 0x4b, 0x7e, 0x4a, 0xdc,
-  0x93, 0xcf, 0xd4, 0x9d, 0x3d, 0x00, 0xf8, 0x88, 0x49, 0x2d, 0xc3, 0xf2,
-  0x60, 0x1f, 0x78, 0xca, 0x86, 0x03, 0x56, 0x94, 0xfc, 0x12, 0xca, 0xc3,
-  0x34, 0x63, 0xe3, 0x27, 0xae, 0x41, 0x16, 0xf9, 0x86, 0x92, 0xa9, 0x81,
-  0x45, 0xf9, 0x37, 0x00, 0x70, 0xed, 0x05, 0x2e, 0x31, 0xac, 0xb3, 0x69,
-  0xc0, 0x28, 0xe9, 0x00, 0x14, 0xf7, 0xfc, 0xb1, 0xfc, 0x02, 0x00, 0x4c,
-  0xd3, 0xe1, 0x1a, 0xbc, 0x5d, 0x1d, 0xfb, 0xdd, 0x03, 0x40, 0x04, 0x82,
-  0x6c, 0xfc, 0xa5, 0x4e, 0x36, 0x6c, 0x00, 0x21, 0xc1, 0xb9, 0x1f, 0x33,
-  0x32, 0xbd, 0x09, 0x18, 0xea, 0x53, 0xc2, 0xf7, 0x4d, 0xec, 0x01, 0x3c,
-  0xec, 0x01, 0xdc, 0x0e, 0x00, 0x60, 0xff, 0xfc, 0x7f, 0x4e, 0x97, 0xb8,
-  0xf3, 0x2a, 0x2b, 0x84, 0x80, 0xac, 0xa2, 0xf1, 0xf9, 0x02, 0xc0, 0xa3,
-  0x00, 0x68, 0xaa, 0xaa, 0x82, 0xde, 0xb7, 0xe3, 0xbe, 0x5e, 0x76, 0x57,
-  0x63, 0x00, 0xd8, 0x83, 0x00, 0xcd, 0x92, 0xe6, 0xdf, 0xe8, 0x71, 0xd2,
-  0x76, 0xb0, 0xb1, 0x0b, 0x76, 0x4f, 0x35, 0xaf, 0x5a, 0x77, 0xe5, 0xdf,
-  0xd1, 0x2e, 0xd9, 0x03, 0xd4, 0x1a, 0x96, 0xe7, 0x42, 0xeb, 0x46, 0x73,
-  0x81, 0xef, 0xd0, 0x80, 0x77, 0x01, 0xd0, 0x98, 0x53, 0x00, 0x68, 0x9a,
-  0x12, 0x97, 0x45, 0x4c, 0x91, 0x81, 0x73, 0x8e, 0x69, 0x36, 0xd1, 0xcb,
-  0x01, 0xa0, 0x5c, 0x01, 0x00, 0x4c, 0x6b, 0x1c, 0x8d, 0x09, 0xcc, 0x36,
-  0xbd, 0x07, 0xf0, 0xe3, 0x5d, 0x6c, 0xb0, 0x5d, 0xc1, 0x12, 0x40, 0x32,
-  0x93, 0x06, 0xc0, 0xa2, 0x4f, 0x00, 0x01, 0x7f, 0xc8, 0x03, 0xe8, 0x4f,
-  0x7a, 0x00, 0xfd, 0x43, 0x00, 0x90, 0x64, 0xff, 0x1a, 0xa3, 0xaa, 0x79,
-  0x01, 0xe0, 0x59, 0x00, 0x68, 0xc0, 0x44, 0x95, 0xc0, 0x53, 0xad, 0x12,
-  0xe7, 0xd9, 0x0c, 0x00, 0xc8, 0x05, 0xd0, 0xeb, 0x4d, 0x56, 0x34, 0x7f,
-  0x98, 0x19, 0xf1, 0xd4, 0x4a, 0x4f, 0x93, 0x16, 0xf6, 0xda, 0x5f, 0x29,
-  0xa0, 0x93, 0x34, 0x70, 0xda, 0x2f, 0x09, 0x8e, 0xc9, 0xcf, 0xb6, 0x17,
-  0xd7, 0x17, 0x41, 0x79, 0xa9, 0x61, 0xc0, 0xa2, 0x48, 0x20, 0xd2, 0x31,
-  0x00, 0xe4, 0x06, 0x94, 0xc8, 0x00, 0x00, 0x3c, 0x67, 0x45, 0xff, 0x58,
-  0x39, 0xb8, 0xf3, 0x7e, 0x07, 0x80, 0x39, 0xed, 0xbd, 0xa7, 0x81, 0x00,
-  0x86, 0x08, 0x40, 0x08, 0x10, 0x06, 0xfc, 0x29, 0x80, 0x61, 0x3f, 0xd6,
-  0x9f, 0x71, 0xda, 0x18, 0x6a, 0xd0, 0x68, 0x58, 0xb8, 0x07, 0x00, 0xed,
-  0xde, 0x6c, 0x25, 0xe2, 0x3e, 0xc6, 0xa2, 0x4f, 0xb2, 0xb1, 0xc4, 0x3d,
-  0x80, 0x23, 0x00, 0x50, 0xc1, 0x1e, 0xe0, 0xdd, 0x9b, 0x7f, 0x71, 0xfe,
-  0x33, 0x00, 0xc0, 0x00, 0xb4, 0x92, 0xd8, 0xe2, 0x17, 0x00, 0x9e, 0x07,
-  0x00, 0xe8, 0x7e, 0xf0, 0xb3, 0xa5, 0xa0, 0x90, 0x05, 0x00, 0xe7, 0x5b,
-  0xf3, 0x1f, 0xc8, 0x37, 0x1e, 0x71, 0x8e, 0x9d, 0x9a, 0x49, 0x58, 0x17,
-  0x40, 0xd2, 0x89, 0xb9, 0x58, 0x00, 0xb0, 0x92, 0xaf, 0x5d, 0x10, 0x2e,
-  0xec, 0x03, 0x60, 0xc4, 0xe5, 0xec, 0xd2, 0x3e, 0x4d, 0xa7, 0x71, 0x95,
-  0x10, 0xf2, 0x18, 0x00, 0x2a, 0x18, 0x32, 0x41, 0x7d, 0x41, 0xfd, 0x65,
-  0x1a, 0x00, 0xda, 0x4f, 0xf1, 0x5c, 0x93, 0xc1, 0x43, 0xda, 0xee, 0x01,
-  0x2c, 0xe9, 0xe0, 0x73, 0xef, 0x6d, 0x5b, 0x9b, 0xa3, 0x63, 0x41, 0xbc,
-  0x09, 0xf8, 0x63, 0x83, 0xc6, 0xac, 0xbc, 0x8f, 0xa2, 0x70, 0xcd, 0x70,
-  0x4f, 0x83, 0x25, 0x00, 0xed, 0x5e, 0x6c, 0xbc, 0x04, 0x13, 0xe8, 0x93,
-  0xc2, 0x23, 0x1e, 0xc0, 0xc7, 0x6d, 0x75, 0x0d, 0x70, 0x17, 0x00, 0x61,
-  0xfe, 0x68, 0xbc, 0x09, 0xad, 0xf5, 0x1e, 0x10, 0xb4, 0x6e, 0x5e, 0x00,
-  0x78, 0x2a, 0x00, 0xfc, 0x8c, 0x28, 0xc5, 0x56, 0xe1, 0x41, 0xc1, 0x8d,
-  0xf9, 0x1b, 0x7b, 0xe7, 0x57, 0xa0, 0x97, 0x0d, 0x1c, 0x70, 0x2e, 0x00,
-  0xf8, 0x67, 0x90, 0xf6, 0x2e, 0x40, 0x2c, 0xbf, 0x72, 0xa1, 0x74, 0x61,
-  0x1f, 0x00, 0xde, 0xa0, 0x5d, 0xfb, 0xec, 0xf8, 0xd0, 0xde, 0xe0, 0xf7,
-  0x00, 0x50, 0x30, 0x21, 0xc3, 0xfa, 0xc2, 0xfa, 0x71, 0xa3, 0x62, 0x0b,
-  0x00, 0x6f, 0xe1, 0x5c, 0x8e, 0xda, 0x0e, 0xb8, 0x7b, 0x69, 0xf4, 0xf6,
-  0x1b, 0x5d, 0xcd, 0x6e, 0xf7, 0x7c, 0x13, 0xf0, 0x87, 0xfa, 0x6f, 0x6d,
-  0xf0, 0x64, 0xd3, 0xf3, 0x67, 0xab, 0x3d, 0x00, 0x77, 0x93, 0x70, 0xc9,
-  0x66, 0x4b, 0x06, 0xfa, 0xb4, 0x00, 0x48, 0xec, 0x01, 0xfc, 0x18, 0x00,
-  0x00, 0xca, 0xd0, 0x35, 0xfa, 0x8c, 0x47, 0xf0, 0x02, 0xc0, 0xd3, 0x00,
-  0x20, 0xc5, 0x41, 0x05, 0x2f, 0x6b, 0x7f, 0x31, 0x09, 0x98, 0xf8, 0x9b,
-  0x06, 0xec, 0x7f, 0x84, 0x25, 0x80, 0xdb, 0x05, 0x20, 0x00, 0x78, 0x17,
-  0x20, 0x96, 0x3f, 0x1f, 0xeb, 0xb8, 0x70, 0x1c, 0x00, 0x9b, 0xf6, 0x1d,
-  0x04, 0x80, 0xf5, 0x6d, 0x7d, 0x7d, 0xab, 0xfa, 0x2f, 0x00, 0x80, 0x75,
-  0x75, 0x6f, 0xd6, 0x1a, 0xf0, 0xaa, 0x9f, 0xfe, 0x34, 0xee, 0xf4, 0xe0,
-  0x5e, 0xba, 0xa0, 0x1b, 0x76, 0xcc, 0xde, 0xb3, 0xf5, 0x4b, 0x00, 0xfd,
-  0x7d, 0x00, 0x18, 0xa3, 0x10, 0x1a, 0xb3, 0x4b, 0xd3, 0x26, 0x20, 0xad,
-  0x4b, 0x4c, 0xfc, 0x8b, 0xa4, 0xb0, 0xbc, 0x45, 0x45, 0xdc, 0xdf, 0x8f,
-  0x78, 0x00, 0x7d, 0x77, 0x0e, 0x00, 0x61, 0xfe, 0xb0, 0x7e, 0x5c, 0x94,
-  0x49, 0xeb, 0x40, 0xbe, 0x00, 0xf0, 0x2f, 0x00, 0xe0, 0xa0, 0x82, 0xc1,
-  0xa2, 0x34, 0xcc, 0xfe, 0xe4, 0x01, 0x8c, 0x13, 0x3a, 0x01, 0xd6, 0xfe,
-  0xed, 0xdd, 0x7f, 0x04, 0x40, 0x45, 0x47, 0x6f, 0xd6, 0x05, 0xd8, 0x5c,
-  0xe9, 0x74, 0xe1, 0xe2, 0xc2, 0x09, 0x00, 0xc8, 0x87, 0x00, 0x00, 0xdf,
-  0x98, 0x97, 0x4b, 0x7d, 0x61, 0xfd, 0xd8, 0xb1, 0xf1, 0x8f, 0x81, 0xac,
-  0x34, 0x63, 0x86, 0x61, 0xd4, 0xd5, 0x5c, 0x5f, 0x3e, 0x5d, 0x14, 0x6e,
-  0x0b, 0x60, 0x6b, 0x6b, 0xdf, 0x12, 0x4c, 0x14, 0x8a, 0xc0, 0x9d, 0x9f,
-  0xaf, 0x6a, 0xb3, 0x61, 0x74, 0x3b, 0x93, 0x9b, 0x46, 0xb9, 0x6c, 0xf3,
-  0xb2, 0x21, 0xee, 0x9f, 0xd4, 0x3d, 0x80, 0x3d, 0x00, 0xd4, 0xf5, 0x39,
-  0x00, 0x84, 0xf9, 0x57, 0x00, 0x80, 0x0e, 0x14, 0x52, 0x37, 0x2f, 0x00,
-  0xfc, 0xd7, 0x01, 0x40, 0x77, 0x02, 0x26, 0x31, 0xd0, 0x6f, 0x04, 0xc1,
-  0xfa, 0xf1, 0x17, 0x80, 0x1a, 0x7f, 0x04, 0xe0, 0x5c, 0x00, 0x3a, 0x7a,
-  0x13, 0x49, 0x00, 0xe4, 0xaf, 0x6e, 0x7e, 0x17, 0x00, 0x72, 0x57, 0xbf,
-  0x5d, 0xdd, 0xd1, 0xcf, 0x81, 0xcf, 0x6e, 0x4a, 0x6d, 0x7f, 0x41, 0xfa,
-  0xbd, 0x00, 0xc8, 0xea, 0x6f, 0x7d, 0xa1, 0xdd, 0x6c, 0xcf, 0x26, 0x57,
-  0x4b, 0x80, 0xa4, 0x01, 0x3e, 0xe8, 0x01, 0x14, 0x6a, 0xfd, 0x4b, 0xc0,
-  0x3d, 0x00, 0xac, 0xf2, 0xc7, 0xfd, 0x27, 0xf3, 0xa7, 0x36, 0x2f, 0x00,
-  0x3c, 0x21, 0xfc, 0x03, 0x92, 0x37, 0x28, 0x2b, 0xf5, 0x1f, 0x3a, 0x87,
-  0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int tiles_png_len = 2388;
@@ -0,0 +1,193 @@
+/* stamps (prefab pieces of levels) for the level editor */
+
+#include <stdio.h>
+#include <stdlib.h>         /* malloc(), free() */
+#include <string.h>         /* memcpy(), memset() */
+
+#include "level.h"
+#include "paint.h"
+#include "stamp.h"
+
+
+static void put16(unsigned char *p, unsigned int v) {
+  p[0] = (v >> 8) & 0xFF;
+  p[1] = v & 0xFF;
+}
+
+
+static unsigned int get16(unsigned char *p) {
+  return((p[0] << 8) | p[1]);
+}
+
+
+/* returns the tile of a cell, as copied: tiles that don't exist (from a
+ * damaged level) are left out, like empty cells */
+static int copiedtile(struct worldstruct *world, int x, int y, int z) {
+  int t = world->tilemap[x][y][z];
+  if ((t < 0) || (t >= WORLD_TILETYPES)) return(0);
+  return(t);
+}
+
+
+void stamp_free(struct stamp *stamp) {
+  free(stamp->run);
+  free(stamp->tiles);
+  memset(stamp, 0, sizeof(struct stamp));
+}
+
+
+int stamp_copy(struct stamp *stamp, struct worldstruct *world, int x1, int y1, int x2, int y2, int layermask) {
+  int x, y, z, t, pass;
+  long tilecount;
+  if (x1 > x2) {
+    t = x1;
+    x1 = x2;
+    x2 = t;
+  }
+  if (y1 > y2) {
+    t = y1;
+    y1 = y2;
+    y2 = t;
+  }
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 >= WORLD_MAXW) x2 = WORLD_MAXW - 1;
+  if (y2 >= WORLD_MAXH) y2 = WORLD_MAXH - 1;
+  stamp_free(stamp);
+  if ((x1 > x2) || (y1 > y2)) return(-1);
+  /* two passes: count the runs and tiles, then fill them in */
+  for (pass = 0; pass < 2; pass++) {
+    stamp->runcount = 0;
+    tilecount = 0;
+    for (z = 0; z < WORLD_LAYERS; z++) {
+      if ((layermask & (1 << z)) == 0) continue;
+      for (y = y1; y <= y2; y++) {
+        for (x = x1; x <= x2; x++) {
+          t = copiedtile(world, x, y, z);
+          if (t == 0) continue;
+          /* a run starts at every non-empty cell following an empty one */
+          if ((x == x1) || (copiedtile(world, x - 1, y, z) == 0)) {
+            if (pass == 1) {
+              stamp->run[stamp->runcount].x = x - x1;
+              stamp->run[stamp->runcount].y = y - y1;
+              stamp->run[stamp->runcount].len = 0;
+              stamp->run[stamp->runcount].z = z;
+              stamp->run[stamp->runcount].tiles = tilecount;
+            }
+            stamp->runcount++;
+          }
+          if (pass == 1) {
+            stamp->run[stamp->runcount - 1].len++;
+            stamp->tiles[tilecount] = t;
+          }
+          tilecount++;
+        }
+      }
+    }
+    if (pass == 0) {
+      stamp->run = malloc((stamp->runcount + 1) * sizeof(struct stamprun));
+      stamp->tiles = malloc(tilecount + 1);
+      if ((stamp->run == NULL) || (stamp->tiles == NULL)) {
+        stamp_free(stamp);
+        return(-1);
+      }
+    }
+  }
+  stamp->tilecount = tilecount;
+  stamp->w = x2 - x1 + 1;
+  stamp->h = y2 - y1 + 1;
+  return(0);
+}
+
+
+int stamp_paste(struct stamp *stamp, struct worldstruct *world, int x, int y, paint_callback callback, void *userdata) {
+  struct stamprun *run;
+  int r, i, cx, cy, oldtile, count = 0;
+  for (r = 0; r < stamp->runcount; r++) {
+    run = &(stamp->run[r]);
+    cy = y + run->y;
+    if ((cy < 0) || (cy >= world->height)) continue;
+    /* the whole run is a straight copy along the row */
+    for (i = 0; i < run->len; i++) {
+      cx = x + run->x + i;
+      if ((cx < 0) || (cx >= world->width)) continue;
+      oldtile = world->tilemap[cx][cy][run->z];
+      if (oldtile == stamp->tiles[run->tiles + i]) continue;
+      world->tilemap[cx][cy][run->z] = stamp->tiles[run->tiles + i];
+      if (callback != NULL) callback(cx, cy, run->z, oldtile, userdata);
+      count++;
+    }
+  }
+  return(count);
+}
+
+
+int stamp_save(struct stamp *stamp, char *file) {
+  unsigned char *buff, *p;
+  long len;
+  int r, res;
+  len = 14 + (long)stamp->runcount * 7 + stamp->tilecount;
+  buff = malloc(len);
+  if (buff == NULL) return(-1);
+  memcpy(buff, STAMP_MAGIC, 4);
+  put16(buff + 4, STAMP_VERSION);
+  put16(buff + 6, stamp->w);
+  put16(buff + 8, stamp->h);
+  put16(buff + 10, (stamp->runcount >> 16) & 0xFFFF);
+  put16(buff + 12, stamp->runcount & 0xFFFF);
+  p = buff + 14;
+  for (r = 0; r < stamp->runcount; r++) {
+    put16(p, stamp->run[r].x);
+    put16(p + 2, stamp->run[r].y);
+    put16(p + 4, stamp->run[r].len);
+    p[6] = stamp->run[r].z;
+    p += 7;
+  }
+  if (stamp->tilecount > 0) memcpy(p, stamp->tiles, stamp->tilecount);
+  res = writefileatomic(file, buff, len);
+  free(buff);
+  return(res);
+}
+
+
+int stamp_load(struct stamp *stamp, char *file) {
+  FILE *fd;
+  unsigned char hdr[14], run[7];
+  long tilecount = 0, i;
+  int r;
+  stamp_free(stamp);
+  fd = fopen(file, "rb");
+  if (fd == NULL) return(-1);
+  if ((fread(hdr, 14, 1, fd) != 1) || (memcmp(hdr, STAMP_MAGIC, 4) != 0) || (get16(hdr + 4) != STAMP_VERSION)) goto FAIL;
+  stamp->runcount = (get16(hdr + 10) << 16) | get16(hdr + 12);
+  if ((stamp->runcount < 0) || (stamp->runcount > WORLD_MAXW * WORLD_MAXH * WORLD_LAYERS)) goto FAIL;
+  stamp->run = malloc((stamp->runcount + 1) * sizeof(struct stamprun));
+  if (stamp->run == NULL) goto FAIL;
+  for (r = 0; r < stamp->runcount; r++) {
+    if (fread(run, 7, 1, fd) != 1) goto FAIL;
+    stamp->run[r].x = get16(run);
+    stamp->run[r].y = get16(run + 2);
+    stamp->run[r].len = get16(run + 4);
+    stamp->run[r].z = run[6];
+    stamp->run[r].tiles = tilecount;
+    /* runs must stay within the stamp */
+    if ((stamp->run[r].z >= WORLD_LAYERS) || (stamp->run[r].x + stamp->run[r].len > get16(hdr + 6)) || (stamp->run[r].y >= get16(hdr + 8))) goto FAIL;
+    tilecount += stamp->run[r].len;
+  }
+  stamp->tiles = malloc(tilecount + 1);
+  if ((stamp->tiles == NULL) || ((tilecount > 0) && (fread(stamp->tiles, tilecount, 1, fd) != 1))) goto FAIL;
+  /* tiles are pasted into the world and drawn as they are */
+  for (i = 0; i < tilecount; i++) {
+    if (stamp->tiles[i] >= WORLD_TILETYPES) goto FAIL;
+  }
+  fclose(fd);
+  stamp->tilecount = tilecount;
+  stamp->w = get16(hdr + 6);
+  stamp->h = get16(hdr + 8);
+  return(0);
+
+  FAIL:
+  fclose(fd);
+  stamp_free(stamp);
+  return(-1);
+}
@@ -0,0 +1,62 @@
+/* stamps (prefab pieces of levels) for the level editor
+ *
+ * A stamp is a rectangle of cells copied from a world, on any number of
+ * layers. It only stores its non-empty cells, as runs of consecutive
+ * non-empty cells along a row of a layer, so a stamp of a few scattered
+ * tiles on a single layer costs a few bytes whatever its size. Empty cells
+ * are transparent: pasting a stamp leaves them untouched.
+ *
+ * stamp file (all values big endian):
+ *   0  magic "APST"
+ *   4  version (16 bits)
+ *   6  width, height in tiles (16 bits each)
+ *  10  runs count (32 bits)
+ *  14  the runs, 7 bytes each: x, y, length (16 bits each), layer (8 bits)
+ *      then the tiles of all runs, one byte each, run after run
+ */
+
+#ifndef STAMP_H_SENTINEL
+#define STAMP_H_SENTINEL
+
+#include "level.h"
+#include "paint.h"
+
+#define STAMP_MAGIC "APST"
+#define STAMP_VERSION 1
+
+struct stamprun {
+  unsigned short x;         /* first cell of the run, relative to the bottom left corner of the stamp */
+  unsigned short y;
+  unsigned short len;
+  unsigned char z;
+  long tiles;               /* index of the run's first tile in the tiles array of the stamp */
+};
+
+struct stamp {
+  int w;                    /* 0 if the stamp is empty */
+  int h;
+  int runcount;
+  struct stamprun *run;     /* sorted by layer, then row, then column */
+  long tilecount;
+  unsigned char *tiles;
+};
+
+/* replaces the content of the stamp by the cells of the given layers (bit z
+ * of layermask set = layer z is copied) in the rectangle between the
+ * (x1,y1) and (x2,y2) corners, included. cells holding a tile that doesn't
+ * exist are copied as empty. returns 0 on success. */
+int stamp_copy(struct stamp *stamp, struct worldstruct *world, int x1, int y1, int x2, int y2, int layermask);
+
+/* pastes the stamp with its bottom left corner on the cell (x,y), calling
+ * back for every cell it changes (see paint.h). returns the number of
+ * changed cells. */
+int stamp_paste(struct stamp *stamp, struct worldstruct *world, int x, int y, paint_callback callback, void *userdata);
+
+/* saves/loads a stamp to/from a file. return 0 on success. saving is atomic. */
+int stamp_save(struct stamp *stamp, char *file);
+int stamp_load(struct stamp *stamp, char *file);
+
+/* frees the content of a stamp, leaving it empty */
+void stamp_free(struct stamp *stamp);
+
+#endif
@@ -0,0 +1,83 @@
+/* startup timeline of Mike O'Possum */
+
+#include <stdio.h>
+#include <string.h>         /* strchr(), strrchr() */
+#include <time.h>           /* clock_gettime() */
+#include <unistd.h>         /* sysconf() */
+
+#include "trace.h"
+
+
+struct tracemark {
+  char *phase;
+  struct timespec ts;
+};
+
+static struct timespec tracestart;
+static long traceexec = -1; /* from the start of the process to main(), in microseconds, -1 if unknown */
+static struct tracemark mark[TRACE_MAXMARKS];
+static int markcount;
+
+
+static long usecs(struct timespec *from, struct timespec *to) {
+  return(((to->tv_sec - from->tv_sec) * 1000000L) + ((to->tv_nsec - from->tv_nsec) / 1000L));
+}
+
+
+/* finds out how long ago the process started, from its start time in
+ * /proc/self/stat (in clock ticks since boot). returns -1 if unknown. */
+static long sinceexec(void) {
+  struct timespec now;
+  char buff[1024], *p;
+  unsigned long starttime;
+  long ticks;
+  size_t len;
+  FILE *fd;
+  int i;
+  ticks = sysconf(_SC_CLK_TCK);
+  if ((ticks <= 0) || (clock_gettime(CLOCK_BOOTTIME, &now) != 0)) return(-1);
+  fd = fopen("/proc/self/stat", "r");
+  if (fd == NULL) return(-1);
+  len = fread(buff, 1, sizeof(buff) - 1, fd);
+  fclose(fd);
+  buff[len] = 0;
+  /* the process name, 2nd field, may hold anything: fields are counted
+   * from the parenthesis that ends it. starttime is the 22nd field. */
+  p = strrchr(buff, ')');
+  if (p == NULL) return(-1);
+  for (i = 2; i < 22; i++) {
+    p = strchr(p + 1, ' ');
+    if (p == NULL) return(-1);
+  }
+  if (sscanf(p, " %lu", &starttime) != 1) return(-1);
+  /* subtract before scaling to microseconds, or a 32 bits long overflows
+   * after half an hour of uptime */
+  return((long)(now.tv_sec - (long)(starttime / ticks)) * 1000000L + now.tv_nsec / 1000L - (long)(starttime % ticks) * (1000000L / ticks));
+}
+
+
+void trace_start(void) {
+  clock_gettime(CLOCK_MONOTONIC, &tracestart);
+  traceexec = sinceexec();
+  markcount = 0;
+}
+
+
+void trace_mark(char *phase) {
+  if (markcount == TRACE_MAXMARKS) return;
+  clock_gettime(CLOCK_MONOTONIC, &mark[markcount].ts);
+  mark[markcount].phase = phase;
+  markcount++;
+}
+
+
+void trace_report(FILE *fd) {
+  struct timespec *prev = &tracestart;
+  int i;
+  /* exec ends where main() starts, hence a total of 0 */
+  if (traceexec >= 0) fprintf(fd, "startup %-20s %9ld us %9ld us +/- %ld us\n", "exec", traceexec, 0L, 1000000L / sysconf(_SC_CLK_TCK));
+  for (i = 0; i < markcount; i++) {
+    fprintf(fd, "startup %-20s %9ld us %9ld us\n", mark[i].phase, usecs(prev, &mark[i].ts), usecs(&tracestart, &mark[i].ts));
+    prev = &mark[i].ts;
+  }
+}
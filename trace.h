@@ -0,0 +1,32 @@
+/* startup timeline of Mike O'Possum
+ *
+ * Records when each phase of the startup ends, from the start of main()
+ * up to the first frame on screen, and tells how long each of them took.
+ * How long the process took to get to main() (loading the binary and its
+ * libraries) is found out from the system, with a much coarser precision.
+ *
+ * Marking the end of a phase only costs a clock read, so it is always
+ * done: printing the timeline is up to the caller. The report has one line
+ * per phase, "startup <phase> <us> <total us>" (the total being counted
+ * from main()), so runs can be compared with nothing more than grep. The
+ * "exec" line, before main(), has a total of 0 and its precision as an
+ * extra field, "+/- <us>". Not thread safe: phases are marked from the main thread only. */
+
+#ifndef TRACE_H_SENTINEL
+#define TRACE_H_SENTINEL
+
+#include <stdio.h>
+
+#define TRACE_MAXMARKS 32
+
+/* starts the timeline. to be called first thing in main() */
+void trace_start(void);
+
+/* marks the end of a phase, that started at the end of the previous one.
+ * phase must stay valid until the report is printed. */
+void trace_mark(char *phase);
+
+/* prints the timeline so far to fd */
+void trace_report(FILE *fd);
+
+#endif
@@ -0,0 +1,127 @@
+/* undo/redo journal of the level editor */
+
+#include <stddef.h>         /* NULL */
+
+#include "level.h"
+#include "undo.h"
+
+
+#define RUN(j, i) ((j)->run[(i) % UNDO_MAXRUNS])
+#define STROKE(j, i) ((j)->stroke[(i) % UNDO_MAXSTROKES])
+
+
+void undo_init(struct undojournal *journal) {
+  journal->runhead = 0;
+  journal->oldest = 0;
+  journal->current = 0;
+  journal->top = 0;
+  journal->recording = 0;
+  journal->overflow = 0;
+}
+
+
+void undo_begin(struct undojournal *journal) {
+  if (journal->recording != 0) undo_end(journal);
+  /* a new stroke wipes out whatever could have been redone */
+  journal->top = journal->current;
+  if (journal->current > journal->oldest) {
+      journal->runhead = STROKE(journal, journal->current - 1).firstrun + STROKE(journal, journal->current - 1).runcount;
+    } else {
+      journal->runhead = 0;
+      journal->oldest = journal->current;
+  }
+  /* make room in the strokes ring if needed */
+  if (journal->current - journal->oldest == UNDO_MAXSTROKES) journal->oldest++;
+  STROKE(journal, journal->current).firstrun = journal->runhead;
+  STROKE(journal, journal->current).runcount = 0;
+  journal->recording = 1;
+  journal->overflow = 0;
+}
+
+
+void undo_record(struct undojournal *journal, int x, int y, int z, int oldtile, int newtile) {
+  struct undostroke *stroke;
+  struct undorun *last;
+  unsigned int cell;
+  if ((journal->recording == 0) || (journal->overflow != 0) || (oldtile == newtile)) return;
+  stroke = &STROKE(journal, journal->current);
+  cell = ((unsigned int)z << 24) | (y * WORLD_MAXW + x);
+  /* extend the last run if this cell simply continues it */
+  if (stroke->runcount > 0) {
+    last = &RUN(journal, journal->runhead - 1);
+    if ((last->cell + last->count == cell) && (last->oldtile == oldtile) && (last->newtile == newtile) && (last->count < 0xFFFF) && ((int)((last->cell & 0xFFFFFF) / WORLD_MAXW) == y)) {
+      last->count++;
+      return;
+    }
+  }
+  /* make room in the runs ring by forgetting the oldest strokes */
+  while ((journal->oldest < journal->current) && (journal->runhead - STROKE(journal, journal->oldest).firstrun >= UNDO_MAXRUNS)) journal->oldest++;
+  if (journal->runhead - stroke->firstrun >= UNDO_MAXRUNS) {
+    /* the stroke alone is bigger than the journal: it can't be undone,
+     * and neither can anything before it */
+    journal->overflow = 1;
+    return;
+  }
+  last = &RUN(journal, journal->runhead);
+  last->cell = cell;
+  last->count = 1;
+  last->oldtile = oldtile;
+  last->newtile = newtile;
+  journal->runhead++;
+  stroke->runcount++;
+}
+
+
+void undo_end(struct undojournal *journal) {
+  if (journal->recording == 0) return;
+  journal->recording = 0;
+  if (journal->overflow != 0) {
+    journal->oldest = journal->current;
+    journal->top = journal->current;
+    journal->runhead = 0;
+    return;
+  }
+  if (STROKE(journal, journal->current).runcount == 0) return; /* nothing happened, forget it */
+  journal->current++;
+  journal->top = journal->current;
+}
+
+
+/* applies all runs of a stroke, backward (undo) or forward (redo) */
+static void applystroke(struct undojournal *journal, struct undostroke *stroke, int backward, struct worldstruct *world, undo_callback callback, void *userdata) {
+  struct undorun *run;
+  unsigned long r, i;
+  int x, y, z;
+  for (r = 0; r < stroke->runcount; r++) {
+    if (backward != 0) {
+        run = &RUN(journal, stroke->firstrun + stroke->runcount - 1 - r);
+      } else {
+        run = &RUN(journal, stroke->firstrun + r);
+    }
+    z = run->cell >> 24;
+    y = (run->cell & 0xFFFFFF) / WORLD_MAXW;
+    for (i = 0; i < run->count; i++) {
+      x = ((run->cell & 0xFFFFFF) % WORLD_MAXW) + i;
+      world->tilemap[x][y][z] = (backward != 0) ? run->oldtile : run->newtile;
+      if (callback != NULL) callback(x, y, z, userdata);
+    }
+  }
+}
+
+
+int undo_undo(struct undojournal *journal, struct worldstruct *world, undo_callback callback, void *userdata) {
+  if (journal->recording != 0) undo_end(journal);
+  if (journal->current == journal->oldest) return(-1);
+  journal->current--;
+  applystroke(journal, &STROKE(journal, journal->current), 1, world, callback, userdata);
+  return(0);
+}
+
+
+int undo_redo(struct undojournal *journal, struct worldstruct *world, undo_callback callback, void *userdata) {
+  if (journal->recording != 0) undo_end(journal);
+  if (journal->current == journal->top) return(-1);
+  applystroke(journal, &STROKE(journal, journal->current), 0, world, callback, userdata);
+  journal->current++;
+  return(0);
+}
@@ -0,0 +1,67 @@
+/* undo/redo journal of the level editor
+ *
+ * Every modification of the tilemap is recorded as a run of cells: a
+ * starting cell, a layer, a length, and the old and new tile of all these
+ * cells. Consecutive cells of a row changing from the same tile to the same
+ * tile are merged into one run, so filling a row costs a single record.
+ * Runs are grouped into strokes (everything done between a mouse button
+ * press and its release, or a whole fill operation), and a stroke is what
+ * gets undone or redone.
+ *
+ * Runs and strokes live in two fixed-size rings: once they are full, the
+ * oldest strokes are forgotten, so memory stays bounded no matter how long
+ * the editing session lasts. */
+
+#ifndef UNDO_H_SENTINEL
+#define UNDO_H_SENTINEL
+
+#include "level.h"
+
+#define UNDO_MAXRUNS 65536    /* 8 bytes each */
+#define UNDO_MAXSTROKES 4096
+
+struct undorun {
+  unsigned int cell;        /* (layer << 24) | (y * WORLD_MAXW + x) */
+  unsigned short count;     /* how many cells along the row */
+  unsigned char oldtile;
+  unsigned char newtile;
+};
+
+struct undostroke {
+  unsigned long firstrun;   /* absolute index of the first run of the stroke */
+  unsigned long runcount;
+};
+
+struct undojournal {
+  struct undorun run[UNDO_MAXRUNS];          /* ring, indexed by absolute run index % UNDO_MAXRUNS */
+  struct undostroke stroke[UNDO_MAXSTROKES]; /* ring, indexed by absolute stroke index % UNDO_MAXSTROKES */
+  unsigned long runhead;    /* absolute index of the next run to be written */
+  unsigned long oldest;     /* absolute index of the oldest stroke still known */
+  unsigned long current;    /* strokes oldest..current-1 can be undone */
+  unsigned long top;        /* strokes current..top-1 can be redone */
+  int recording;            /* non-zero between undo_begin() and undo_end() */
+  int overflow;             /* the stroke being recorded did not fit in the journal */
+};
+
+/* called for every cell modified by undo_undo() or undo_redo() */
+typedef void (*undo_callback)(int x, int y, int z, void *userdata);
+
+void undo_init(struct undojournal *journal);
+
+/* opens a new stroke. all changes recorded until undo_end() will be
+ * undone at once. */
+void undo_begin(struct undojournal *journal);
+
+/* records that the cell (x,y,z) changed from oldtile to newtile */
+void undo_record(struct undojournal *journal, int x, int y, int z, int oldtile, int newtile);
+
+/* closes the current stroke */
+void undo_end(struct undojournal *journal);
+
+/* undoes (or redoes) the last undone stroke on world, calling back for
+ * each modified cell. return 0 on success, -1 if there is nothing to
+ * undo (or redo). */
+int undo_undo(struct undojournal *journal, struct worldstruct *world, undo_callback callback, void *userdata);
+int undo_redo(struct undojournal *journal, struct worldstruct *world, undo_callback callback, void *userdata);
+
+#endif